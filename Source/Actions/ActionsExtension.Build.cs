@@ -1,5 +1,6 @@
 // Copyright 2015-2026 Piperift. All Rights Reserved.
 
+using System.Linq;
 using UnrealBuildTool;
 
 public class ActionsExtension : ModuleRules
@@ -12,10 +13,21 @@ public class ActionsExtension : ModuleRules
 			"Core",
 			"CoreUObject",
 			"Engine",
-			"AIModule"
+			"AIModule",
+			"DeveloperSettings",
+			"GameplayTags"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { });
+		// Without the significance manager, significance only comes from a custom provider
+		if (IsPluginEnabled(TargetRules, "SignificanceManager"))
+		{
+			PrivateDependencyModuleNames.Add("SignificanceManager");
+			PublicDefinitions.Add("WITH_SIGNIFICANCE_MANAGER=1");
+		}
+		else
+		{
+			PublicDefinitions.Add("WITH_SIGNIFICANCE_MANAGER=0");
+		}
 
 		if (TargetRules.bBuildDeveloperTools || (Target.Configuration != UnrealTargetConfiguration.Shipping && Target.Configuration != UnrealTargetConfiguration.Test))
 		{
@@ -27,4 +39,22 @@ public class ActionsExtension : ModuleRules
 			PublicDefinitions.Add("WITH_GAMEPLAY_DEBUGGER=0");
 		}
 	}
+
+	// Optional plugins this plugin depends on are enabled unless the target or the project disables them
+	private static bool IsPluginEnabled(ReadOnlyTargetRules TargetRules, string PluginName)
+	{
+		if (TargetRules.DisablePlugins.Contains(PluginName))
+		{
+			return false;
+		}
+		if (TargetRules.EnablePlugins.Contains(PluginName) || TargetRules.ProjectFile == null)
+		{
+			return true;
+		}
+
+		ProjectDescriptor Project = ProjectDescriptor.FromFile(TargetRules.ProjectFile);
+		PluginReferenceDescriptor Reference =
+			Project.Plugins?.FirstOrDefault(Plugin => Plugin.Name == PluginName);
+		return Reference == null || Reference.bEnabled;
+	}
 }
@@ -25,6 +25,16 @@ UAction* CreateAction(UObject* Owner, const TSubclassOf<class UAction> Class, bo
 		return nullptr;
 	}
 
+	// Duplicates are resolved before allocating
+	const EActionUniquenessCheck Check =
+		bAutoActivate ? EActionUniquenessCheck::CreateAndActivate : EActionUniquenessCheck::Create;
+	UAction* Existing = nullptr;
+	UActionsSubsystem* Subsystem = UActionsSubsystem::Get(Owner->GetWorld());
+	if (Subsystem && !Subsystem->ApplyUniqueness(Owner, Class->GetDefaultObject<UAction>(), Check, Existing))
+	{
+		return nullptr;
+	}
+
 	UAction* Action = NewObject<UAction>(Owner, Class);
 	if (bAutoActivate)
 	{
@@ -43,6 +53,15 @@ UAction* CreateAction(UObject* Owner, const UAction* Template, bool bAutoActivat
 	UClass* const Class = Template->GetClass();
 	check(Class);
 
+	const EActionUniquenessCheck Check =
+		bAutoActivate ? EActionUniquenessCheck::CreateAndActivate : EActionUniquenessCheck::Create;
+	UAction* Existing = nullptr;
+	UActionsSubsystem* Subsystem = UActionsSubsystem::Get(Owner->GetWorld());
+	if (Subsystem && !Subsystem->ApplyUniqueness(Owner, Template, Check, Existing))
+	{
+		return nullptr;
+	}
+
 	UAction* Action = NewObject<UAction>(Owner, Class, NAME_None, RF_NoFlags, const_cast<UAction*>(Template));
 	if (bAutoActivate)
 	{
@@ -51,6 +70,118 @@ UAction* CreateAction(UObject* Owner, const UAction* Template, bool bAutoActivat
 	return Action;
 }
 
+static TArray<UAction*> CreateActionsForOwners(
+	TArrayView<UObject* const> Owners, UClass* Class, const UAction* Template, bool bAutoActivate)
+{
+	TArray<UAction*> Actions;
+	if (!Class || Owners.IsEmpty())
+	{
+		return Actions;
+	}
+	Actions.Reserve(Owners.Num());
+
+	// Class data is resolved once for all owners
+	const UAction* const Defaults = Template ? Template : Class->GetDefaultObject<UAction>();
+	const bool bUniquenessTracked = Defaults->IsUniquenessTracked();
+	const EActionUniquenessCheck Check =
+		bAutoActivate ? EActionUniquenessCheck::CreateAndActivate : EActionUniquenessCheck::Create;
+
+	// Owners of a batch usually share a world
+	UWorld* World = nullptr;
+	UActionsSubsystem* Subsystem = nullptr;
+	for (UObject* Owner : Owners)
+	{
+		UWorld* const OwnerWorld = IsValid(Owner) ? Owner->GetWorld() : nullptr;
+		if (!IsValid(OwnerWorld))
+		{
+			Actions.Add(nullptr);
+			continue;
+		}
+		if (OwnerWorld != World)
+		{
+			World = OwnerWorld;
+			Subsystem = UActionsSubsystem::Get(World);
+			if (Subsystem)
+			{
+				Subsystem->ReserveActions(Defaults, Owners.Num() - Actions.Num(), bAutoActivate);
+			}
+		}
+
+		UAction* Existing = nullptr;
+		if (bUniquenessTracked && Subsystem && !Subsystem->ApplyUniqueness(Owner, Defaults, Check, Existing))
+		{
+			Actions.Add(nullptr);
+			continue;
+		}
+
+		UAction* const Action =
+			NewObject<UAction>(Owner, Class, NAME_None, RF_NoFlags, const_cast<UAction*>(Template));
+		if (bAutoActivate)
+		{
+			Action->Activate();
+		}
+		Actions.Add(Action);
+	}
+	return Actions;
+}
+
+TArray<UAction*> CreateActions(
+	TArrayView<UObject* const> Owners, const TSubclassOf<UAction> Class, bool bAutoActivate /*= false*/)
+{
+	return CreateActionsForOwners(Owners, Class.Get(), nullptr, bAutoActivate);
+}
+
+TArray<UAction*> CreateActions(
+	TArrayView<UObject* const> Owners, const UAction* Template, bool bAutoActivate /*= false*/)
+{
+	return CreateActionsForOwners(Owners, Template ? Template->GetClass() : nullptr, Template, bAutoActivate);
+}
+
+UAction* CreateActionInChannel(
+	UObject* Owner, const TSubclassOf<UAction> Class, FName Channel, FActionCreatedDelegate OnCreated /*= {}*/)
+{
+	UActionsSubsystem* Subsystem = IsValid(Owner) ? UActionsSubsystem::Get(Owner->GetWorld()) : nullptr;
+	if (!Subsystem)
+	{
+		OnCreated.ExecuteIfBound(nullptr);
+		return nullptr;
+	}
+	return Subsystem->CreateActionInChannel(Owner, Class.Get(), nullptr, Channel, MoveTemp(OnCreated));
+}
+
+UAction* CreateActionInChannel(
+	UObject* Owner, const UAction* Template, FName Channel, FActionCreatedDelegate OnCreated /*= {}*/)
+{
+	UActionsSubsystem* Subsystem = IsValid(Owner) ? UActionsSubsystem::Get(Owner->GetWorld()) : nullptr;
+	if (!Subsystem)
+	{
+		OnCreated.ExecuteIfBound(nullptr);
+		return nullptr;
+	}
+	return Subsystem->CreateActionInChannel(Owner, nullptr, Template, Channel, MoveTemp(OnCreated));
+}
+
+void CreateActionAsync(UObject* Owner, const TSoftClassPtr<UAction>& Class, bool bAutoActivate /*= true*/,
+	FActionCreatedDelegate OnCreated /*= {}*/)
+{
+	UActionsSubsystem* Subsystem =
+		IsValid(Owner) ? UActionsSubsystem::Get(Owner->GetWorld()) : nullptr;
+	if (Class.IsNull() || !Subsystem)
+	{
+		OnCreated.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	// Class is already loaded, no need to wait
+	if (UClass* const LoadedClass = Class.Get())
+	{
+		OnCreated.ExecuteIfBound(CreateAction(Owner, LoadedClass, bAutoActivate));
+		return;
+	}
+
+	Subsystem->RequestActionClass(Class, {Owner, bAutoActivate, MoveTemp(OnCreated)});
+}
+
 
 bool UAction::Activate()
 {
@@ -69,6 +200,11 @@ bool UAction::Activate()
 		return false;
 	}
 
+	if ((State == EActionState::Running || State == EActionState::Pending) && IsValid(this))
+	{
+		return true;	// Already active
+	}
+
 	if (!IsValid(this) || !IsValid(GetOuter()) || State != EActionState::Preparing)
 	{
 		UE_LOG(
@@ -77,6 +213,40 @@ bool UAction::Activate()
 		return false;
 	}
 
+	// Finished parents are only marked as garbage at teardown, so they are still valid
+	if (HasEndedParent())
+	{
+		UE_LOG(LogActions, Verbose, TEXT("Could not activate '%s'. Its parent action ended."), *GetName());
+		Destroy();
+		return false;
+	}
+
+	if (bDeferredActivation)
+	{
+		// The subsystem activates it in a later frame
+		State = EActionState::Pending;
+		Subsystem->AddPendingActivation(this);
+		return true;
+	}
+	return StartActivation(Subsystem);
+}
+
+bool UAction::StartActivation(UActionsSubsystem* Subsystem)
+{
+	if (HasEndedParent())
+	{
+		UE_LOG(LogActions, Verbose, TEXT("Could not activate '%s'. Its parent action ended."), *GetName());
+		Destroy();
+		return false;
+	}
+
+	if (!BlockTags.IsEmpty() && Subsystem->HasActionsWithTags(GetOwner(), BlockTags))
+	{
+		UE_LOG(LogActions, Log, TEXT("Could not activate '%s'. Blocked by a running action."), *GetName());
+		Destroy();
+		return false;
+	}
+
 	if (!CanActivate())
 	{
 		UE_LOG(LogActions, Log, TEXT("Could not activate. CanActivate() Failed."));
@@ -84,10 +254,37 @@ bool UAction::Activate()
 		return false;
 	}
 
+	// Checked last, since it can cancel or refresh the running action of this class
+	UAction* Existing = nullptr;
+	if (!GetParentAction() &&
+		!Subsystem->ApplyUniqueness(GetOuter(), this, EActionUniquenessCheck::Activate, Existing))
+	{
+		UE_LOG(LogActions, Verbose, TEXT("Could not activate '%s'. Already running its class."), *GetName());
+		Destroy();
+		return false;
+	}
+
+	if (!CancelTags.IsEmpty())
+	{
+		Subsystem->CancelActionsWithTags(GetOwner(), CancelTags);
+
+		// Our own parent could have been cancelled
+		if (HasEndedParent())
+		{
+			Destroy();
+			return false;
+		}
+	}
+
 	// Add this action to its parent
 	if (auto* ParentAction = GetParentAction())
 	{
 		ParentAction->AddChildren(this);
+		TimeDilation = ParentAction->TimeDilation;
+		if (ParentAction->IsSuspended())
+		{
+			AddSuspension();
+		}
 	}
 	else
 	{
@@ -100,6 +297,7 @@ bool UAction::Activate()
 	}
 
 	State = EActionState::Running;
+	Subsystem->AddActionToIndices(this);
 	OnActivation();
 	return IsRunning() || Succeeded();
 }
@@ -111,7 +309,8 @@ void UAction::Cancel()
 		return;
 	}
 
-	if (!IsRunning())
+	// Pending actions notify they were cancelled too, since something could be waiting for them
+	if (!IsRunning() && !IsPending())
 	{
 		Destroy();
 		return;
@@ -128,6 +327,12 @@ void UAction::OnFinish(const EActionState Reason)
 	{
 		World->GetLatentActionManager().RemoveActionsForObject(this);
 		World->GetTimerManager().ClearAllTimersForObject(this);
+		// Owned timers can be bound to other objects
+		for (FTimerHandle& Handle : OwnedTimers)
+		{
+			World->GetTimerManager().ClearTimer(Handle);
+		}
+		OwnedTimers.Empty();
 	}
 
 	OnFinishedDelegate.Broadcast(Reason);
@@ -150,8 +355,9 @@ void UAction::Finish(bool bSuccess)
 	State = bSuccess ? EActionState::Success : EActionState::Failure;
 	OnFinish(State);
 
-	// Remove from parent action
-	if (auto* ParentAction = GetParentAction())
+	// Removed from its parent action at teardown, unless there is no subsystem to batch it
+	UAction* ParentAction = GetParentAction();
+	if (ParentAction && !GetSubsystem())
 	{
 		ParentAction->RemoveChildren(this);
 	}
@@ -161,7 +367,7 @@ void UAction::Finish(bool bSuccess)
 
 void UAction::Destroy()
 {
-	if (!IsValid(this))
+	if (!IsValid(this) || bPendingTeardown)
 	{
 		return;
 	}
@@ -176,7 +382,172 @@ void UAction::Destroy()
 	}
 	ChildrenActions.Reset();
 
-	MarkAsGarbage();
+	UActionsSubsystem* Subsystem = GetSubsystem();
+	if (!Subsystem)
+	{
+		Arena.Reset();
+		MarkAsGarbage();
+		return;
+	}
+
+	// Queries, tags and uniqueness must stop seeing this action right away
+	Subsystem->RemoveActionFromIndices(this);
+	if (OwnerId.IsValidId())
+	{
+		Subsystem->ReleaseClassSlot(this);
+	}
+
+	// Frees our slot, which can start the next queued action of the channel
+	if (!Channel.IsNone())
+	{
+		Subsystem->ReleaseChannelSlot(this);
+	}
+
+	// Removal from owner, parent and tick group arrays is batched at the end of the subsystem tick
+	Subsystem->AddTeardown(this);
+}
+
+void UAction::Suspend()
+{
+	if (!bSuspended && IsRunning())
+	{
+		bSuspended = true;
+		AddSuspension();
+	}
+}
+
+void UAction::Resume()
+{
+	if (bSuspended)
+	{
+		bSuspended = false;
+		RemoveSuspension();
+	}
+}
+
+void UAction::AddSuspension()
+{
+	if (SuspensionCount++ > 0)
+	{
+		return;	   // Already suspended
+	}
+
+	if (UActionsSubsystem* Subsystem = GetSubsystem())
+	{
+		Subsystem->RemoveActionFromTickGroup(this);
+	}
+	SetTimersPaused(true);
+
+	for (auto* Children : ChildrenActions)
+	{
+		if (Children)
+		{
+			Children->AddSuspension();
+		}
+	}
+}
+
+void UAction::RemoveSuspension()
+{
+	if (!ensure(SuspensionCount > 0) || --SuspensionCount > 0)
+	{
+		return;	   // Still suspended
+	}
+
+	SetTimersPaused(false);
+	UActionsSubsystem* Subsystem = GetSubsystem();
+	if (Subsystem && bWantsToTick && IsRunning())
+	{
+		Subsystem->AddActionToTickGroup(this);
+	}
+
+	for (auto* Children : ChildrenActions)
+	{
+		if (Children)
+		{
+			Children->RemoveSuspension();
+		}
+	}
+}
+
+void UAction::SetTimersPaused(bool bPaused)
+{
+	UWorld* World = GetWorld();
+	if (!World || OwnedTimers.IsEmpty())
+	{
+		return;
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	OwnedTimers.RemoveAllSwap([&TimerManager](const FTimerHandle& Handle) {
+		return !TimerManager.TimerExists(Handle);
+	});
+	for (const FTimerHandle& Handle : OwnedTimers)
+	{
+		if (bPaused)
+		{
+			TimerManager.PauseTimer(Handle);
+		}
+		else
+		{
+			TimerManager.UnPauseTimer(Handle);
+		}
+	}
+}
+
+FTimerHandle UAction::SetTimer(FTimerDelegate Delegate, float Time, bool bLooping)
+{
+	UWorld* World = GetWorld();
+	if (!World || !IsRunning())
+	{
+		return {};
+	}
+
+	FTimerHandle Handle;
+	World->GetTimerManager().SetTimer(Handle, MoveTemp(Delegate), Time, bLooping);
+	AddOwnedTimer(Handle);
+	return Handle;
+}
+
+FTimerHandle UAction::SetTimerByEvent(FTimerDynamicDelegate Event, float Time, bool bLooping)
+{
+	UWorld* World = GetWorld();
+	if (!World || !IsRunning() || !Event.IsBound())
+	{
+		return {};
+	}
+
+	FTimerHandle Handle;
+	World->GetTimerManager().SetTimer(Handle, Event, Time, bLooping);
+	AddOwnedTimer(Handle);
+	return Handle;
+}
+
+void UAction::AddOwnedTimer(const FTimerHandle& Handle)
+{
+	if (Handle.IsValid())
+	{
+		OwnedTimers.Add(Handle);
+		if (IsSuspended())
+		{
+			GetWorld()->GetTimerManager().PauseTimer(Handle);
+		}
+	}
+}
+
+FActionArena& UAction::GetArena()
+{
+	UAction* Root = this;
+	while (UAction* Parent = Root->GetParentAction())
+	{
+		Root = Parent;
+	}
+
+	if (!Root->Arena)
+	{
+		Root->Arena = MakeUnique<FActionArena>();
+	}
+	return *Root->Arena;
 }
 
 void UAction::AddChildren(UAction* Child)
@@ -204,6 +575,16 @@ bool UAction::IsRunning() const
 	return State == EActionState::Running;
 }
 
+bool UAction::IsPending() const
+{
+	return State == EActionState::Pending;
+}
+
+bool UAction::IsSuspended() const
+{
+	return SuspensionCount > 0;
+}
+
 bool UAction::Succeeded() const
 {
 	return State == EActionState::Success;
@@ -229,12 +610,30 @@ UAction* UAction::GetParentAction() const
 	return Cast<UAction>(GetOuter());
 }
 
+bool UAction::HasEndedParent() const
+{
+	const UAction* const Parent = GetParentAction();
+	return Parent && (!IsValid(Parent) || Parent->bPendingTeardown || !Parent->IsRunning());
+}
+
 float UAction::GetTickRate() const
 {
 	// Reduce TickRate Precision to 0.1ms
 	return FMath::FloorToFloat(TickRate * 10000.f) * 0.0001f;
 }
 
+SIZE_T UAction::GetAllocatedSize() const
+{
+	SIZE_T Size = ChildrenActions.GetAllocatedSize() + OwnedTimers.GetAllocatedSize() +
+				  Tags.GetGameplayTagArray().GetAllocatedSize() + CancelTags.GetGameplayTagArray().GetAllocatedSize() +
+				  BlockTags.GetGameplayTagArray().GetAllocatedSize();
+	if (Arena)
+	{
+		Size += sizeof(FActionArena) + Arena->GetAllocatedSize();
+	}
+	return Size;
+}
+
 UObject* UAction::GetOwner() const
 {
 	return Owner.Get();
@@ -296,12 +695,20 @@ void UAction::DescribeSelfToGameplayDebugger(FGameplayDebugger_Actions& Debugger
 		IndentString += "  ";
 	}
 
-	const FString CanceledSuffix = (State == EActionState::Cancelled) ? TEXT("CANCELLED") : FString{};
+	FString StateSuffix;
+	if (State == EActionState::Cancelled)
+	{
+		StateSuffix = TEXT("CANCELLED");
+	}
+	else if (IsSuspended())
+	{
+		StateSuffix = TEXT("SUSPENDED");
+	}
 
 	if (IsRunning())
 	{
 		Debugger.AddTextLine(
-			FString::Printf(TEXT("%s%s>%s %s"), *IndentString, *ColorText, *GetName(), *CanceledSuffix));
+			FString::Printf(TEXT("%s%s>%s %s"), *IndentString, *ColorText, *GetName(), *StateSuffix));
 
 		for (const auto* ChildAction : ChildrenActions)
 		{
@@ -323,7 +730,14 @@ void UAction::SetWantsToTick(bool bValue)
 	if (bValue != bWantsToTick)
 	{
 		bWantsToTick = bValue;
+
+		// Actions are added to tick groups on activation
 		UActionsSubsystem* Subsystem = GetSubsystem();
+		if (!IsRunning() || !Subsystem)
+		{
+			return;
+		}
+
 		if (bValue)
 		{
 			Subsystem->AddActionToTickGroup(this);
@@ -335,6 +749,21 @@ void UAction::SetWantsToTick(bool bValue)
 	}
 }
 
+void UAction::SetTickRate(float Value)
+{
+	Value = FMath::Max(Value, 0.f);
+	if (Value != TickRate)
+	{
+		TickRate = Value;
+
+		// Moves to the tick group of the new rate, if in one
+		if (UActionsSubsystem* Subsystem = GetSubsystem())
+		{
+			Subsystem->RescheduleAction(this);
+		}
+	}
+}
+
 void UAction::PostInitProperties()
 {
 	Super::PostInitProperties();
@@ -348,9 +777,24 @@ void UAction::PostInitProperties()
 	{
 		Owner = Outer;
 	}
+
+	if (!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		CachedSubsystem = UActionsSubsystem::Get(GetWorld());
+	}
+}
+
+void UAction::BeginDestroy()
+{
+	Arena.Reset();
+	Super::BeginDestroy();
 }
 
 UActionsSubsystem* UAction::GetSubsystem() const
 {
+	if (UActionsSubsystem* const Result = CachedSubsystem.Get())
+	{
+		return Result;
+	}
 	return UActionsSubsystem::Get(GetWorld());
 }
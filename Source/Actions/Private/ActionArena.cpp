@@ -0,0 +1,45 @@
+// Copyright 2015-2026 Piperift. All Rights Reserved.
+
+#include "ActionArena.h"
+
+
+void* FActionArena::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	uint8* Start = Cursor ? Align(Cursor, Alignment) : nullptr;
+	if (!Start || Start + Size > End)
+	{
+		// Big allocations get a block of their own size
+		const SIZE_T BlockSize = FMath::Max(NextBlockSize, Size + Alignment);
+		uint8* const Block = static_cast<uint8*>(FMemory::Malloc(BlockSize));
+		Blocks.Add(Block);
+		AllocatedSize += BlockSize;
+		NextBlockSize = FMath::Min(NextBlockSize * 2, MaxBlockSize);
+
+		Cursor = Block;
+		End = Block + BlockSize;
+		Start = Align(Cursor, Alignment);
+	}
+
+	Cursor = Start + Size;
+	return Start;
+}
+
+void FActionArena::Reset()
+{
+	for (int32 i = Destructors.Num() - 1; i >= 0; --i)
+	{
+		Destructors[i].Destroy(Destructors[i].Object);
+	}
+	Destructors.Empty();
+
+	for (void* Block : Blocks)
+	{
+		FMemory::Free(Block);
+	}
+	Blocks.Empty();
+
+	Cursor = nullptr;
+	End = nullptr;
+	NextBlockSize = MinBlockSize;
+	AllocatedSize = 0;
+}
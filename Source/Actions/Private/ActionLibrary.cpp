@@ -1,3 +1,22 @@
 // Copyright 2015-2026 Piperift. All Rights Reserved.
 
 #include "ActionLibrary.h"
+
+
+void UActionLibrary::CreateActionAsync(UObject* Owner, const TSoftClassPtr<UAction> Class,
+	const FActionCreatedDynamicDelegate& OnCreated, bool bAutoActivate)
+{
+	::CreateActionAsync(Owner, Class, bAutoActivate,
+		FActionCreatedDelegate::CreateLambda([OnCreated](UAction* Action) {
+			OnCreated.ExecuteIfBound(Action);
+		}));
+}
+
+UAction* UActionLibrary::CreateActionInChannel(UObject* Owner, const TSubclassOf<UAction> Class, FName Channel,
+	const FActionCreatedDynamicDelegate& OnCreated)
+{
+	return ::CreateActionInChannel(Owner, Class, Channel,
+		FActionCreatedDelegate::CreateLambda([OnCreated](UAction* Action) {
+			OnCreated.ExecuteIfBound(Action);
+		}));
+}
@@ -0,0 +1,61 @@
+// Copyright 2015-2026 Piperift. All Rights Reserved.
+
+#include "ActionsSettings.h"
+
+#include "Action.h"
+
+#include <Engine/World.h>
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ActionsSettings)
+
+
+UActionsSettings::UActionsSettings()
+{
+	SupportedWorldTypes = {EWorldType::Game, EWorldType::Editor, EWorldType::PIE, EWorldType::EditorPreview,
+		EWorldType::GamePreview, EWorldType::GameRPC, EWorldType::Inactive};
+	MaxTickDelays = {
+		{EActionPriority::High, 0.05f}, {EActionPriority::Normal, 0.2f}, {EActionPriority::Low, 1.f}};
+	MaxThrottleScales = {{EActionPriority::Normal, 2.f}, {EActionPriority::Low, 4.f}};
+}
+
+const FActionClassList* UActionsSettings::FindPreloadedClasses(const UWorld* World) const
+{
+	if (!World || PreloadedClasses.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	// PIE worlds are renamed with a prefix, compare against the original package
+	const FString PackageName = UWorld::RemovePIEPrefix(World->GetOutermost()->GetName());
+	for (const auto& It : PreloadedClasses)
+	{
+		if (It.Key.GetLongPackageName() == PackageName)
+		{
+			return &It.Value;
+		}
+	}
+	return nullptr;
+}
+
+float UActionsSettings::GetMaxThrottleScale() const
+{
+	float MaxScale = 1.f;
+	for (const auto& It : MaxThrottleScales)
+	{
+		MaxScale = FMath::Max(MaxScale, It.Value);
+	}
+	return MaxScale;
+}
+
+int32 UActionsSettings::FindSignificanceTier(float Significance) const
+{
+	for (int32 i = 0; i < SignificanceTiers.Num(); ++i)
+	{
+		if (Significance >= SignificanceTiers[i].MinSignificance)
+		{
+			return i;
+		}
+	}
+	return SignificanceTiers.Num() - 1;
+}
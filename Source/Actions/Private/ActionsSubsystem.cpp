@@ -3,62 +3,193 @@
 #include "ActionsSubsystem.h"
 
 #include "Action.h"
+#include "ActionsExtensionModule.h"
+#include "ActionsSettings.h"
 
+#include <Components/ActorComponent.h>
+#include <Engine/AssetManager.h>
+#include <Engine/Level.h>
+#include <GameFramework/Actor.h>
 #include <GameFramework/WorldSettings.h>
+#include <HAL/IConsoleManager.h>
+#include <Misc/App.h>
 
 
 #if WITH_GAMEPLAY_DEBUGGER
 #	include "GameplayDebugger_Actions.h"
 #endif	  // WITH_GAMEPLAY_DEBUGGER
 
+#if WITH_SIGNIFICANCE_MANAGER
+#	include <SignificanceManager.h>
+#endif	  // WITH_SIGNIFICANCE_MANAGER
+
+
+DECLARE_CYCLE_STAT(TEXT("Tick"), STAT_ActionsTick, STATGROUP_Actions);
+DECLARE_CYCLE_STAT(TEXT("Update Significance"), STAT_ActionsUpdateSignificance, STATGROUP_Actions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Action Ticks"), STAT_ActionTicks, STATGROUP_Actions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Groups (Critical)"), STAT_ActionsDeferredCritical, STATGROUP_Actions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Groups (High)"), STAT_ActionsDeferredHigh, STATGROUP_Actions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Groups (Normal)"), STAT_ActionsDeferredNormal, STATGROUP_Actions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Groups (Low)"), STAT_ActionsDeferredLow, STATGROUP_Actions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Late Groups"), STAT_ActionsLateGroups, STATGROUP_Actions);
+DECLARE_CYCLE_STAT(TEXT("Process Create Requests"), STAT_ActionsProcessCreateRequests, STATGROUP_Actions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Created From Requests"), STAT_ActionsCreatedFromRequests, STATGROUP_Actions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rejected Create Requests"), STAT_ActionsRejectedRequests, STATGROUP_Actions);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pending Create Requests"), STAT_ActionsPendingRequests, STATGROUP_Actions);
+DECLARE_CYCLE_STAT(TEXT("Teardown"), STAT_ActionsTeardown, STATGROUP_Actions);
+DECLARE_CYCLE_STAT(TEXT("Release All"), STAT_ActionsRelease, STATGROUP_Actions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Torn Down Actions"), STAT_ActionsTornDown, STATGROUP_Actions);
+DECLARE_CYCLE_STAT(TEXT("Deferred Activations"), STAT_ActionsProcessActivations, STATGROUP_Actions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Activations"), STAT_ActionsDeferredActivations, STATGROUP_Actions);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pending Activations"), STAT_ActionsPendingActivations, STATGROUP_Actions);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deduplicated Requests"), STAT_ActionsDeduplicated, STATGROUP_Actions);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Reduced Rate Owners"), STAT_ActionsReducedRateOwners, STATGROUP_Actions);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Dormant Owners"), STAT_ActionsDormantOwners, STATGROUP_Actions);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Dormant Actions"), STAT_ActionsDormant, STATGROUP_Actions);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Dormant Ticking Actions"), STAT_ActionsDormantTicking, STATGROUP_Actions);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Throttle Scale"), STAT_ActionsThrottleScale, STATGROUP_Actions);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Throttle Frame Time (ms)"), STAT_ActionsFrameTime, STATGROUP_Actions);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Throttled Groups"), STAT_ActionsThrottledGroups, STATGROUP_Actions);
+
+
+static TAutoConsoleVariable<int32> CVarThrottle(TEXT("Actions.Throttle"), -1,
+	TEXT("Throttles action ticks while the frame time is over target. -1: project settings, 0: off, 1: on"));
+
+static TAutoConsoleVariable<float> CVarThrottleTargetFrameTime(TEXT("Actions.Throttle.TargetFrameTime"), 0.f,
+	TEXT("Frame time in ms action throttling tries to keep. 0 uses project settings"));
+
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice MemReportCommand(TEXT("Actions.MemReport"),
+	TEXT("Logs memory used by running actions of each class and by the index data of their classes"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda(
+		[](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar) {
+			if (const UActionsSubsystem* Subsystem = UActionsSubsystem::Get(World))
+			{
+				Subsystem->DumpMemoryReport(Ar);
+			}
+		}));
+
+
+static ULevel* GetOwnerLevel(const UObject* Owner)
+{
+	const AActor* Actor = Cast<AActor>(Owner);
+	if (!Actor)
+	{
+		if (const UActorComponent* Component = Cast<UActorComponent>(Owner))
+		{
+			Actor = Component->GetOwner();
+		}
+	}
+	return Actor ? Actor->GetLevel() : nullptr;
+}
+
+static float GetOwnerTimeDilation(const UObject* Owner)
+{
+	if (const AActor* Actor = Cast<AActor>(Owner))
+	{
+		return Actor->CustomTimeDilation;
+	}
+	else if (const UActorComponent* Component = Cast<UActorComponent>(Owner))
+	{
+		const AActor* Actor = Component->GetOwner();
+		return Actor ? Actor->CustomTimeDilation : 1.f;
+	}
+	return 1.f;
+}
+
+/** @return tags of an action and their parents. Shared with its class unless the instance has its own tags */
+static const FGameplayTagContainer& GetTagsWithParents(
+	const UAction* Action, const FActionClassDescriptor& Descriptor, FGameplayTagContainer& OutOwnTags)
+{
+	if (Action->GetTags() == Descriptor.Tags)
+	{
+		return Descriptor.TagsWithParents;
+	}
+	OutOwnTags = Action->GetTags().GetGameplayTagParents();
+	return OutOwnTags;
+}
+
+static void IncDeferredGroupsStat(EActionPriority Priority)
+{
+	switch (Priority)
+	{
+		case EActionPriority::Critical:
+			INC_DWORD_STAT(STAT_ActionsDeferredCritical);
+			break;
+		case EActionPriority::High:
+			INC_DWORD_STAT(STAT_ActionsDeferredHigh);
+			break;
+		case EActionPriority::Normal:
+			INC_DWORD_STAT(STAT_ActionsDeferredNormal);
+			break;
+		case EActionPriority::Low:
+			INC_DWORD_STAT(STAT_ActionsDeferredLow);
+			break;
+	}
+}
+
 
 void FActionsTickGroup::Tick(float DeltaTime)
 {
-	if (Actions.Num() <= 0)
+	AddTime(DeltaTime);
+	if (IsDue())
+	{
+		TickElapsed();
+	}
+}
+
+void FActionsTickGroup::TickElapsed()
+{
+	// Deferred groups and groups ticking every frame but throttled tick with all the time they waited
+	if (TickMode == EActionTickMode::Variable || TickRate <= KINDA_SMALL_NUMBER)
 	{
+		DelayedTick(TickTimeElapsed);
+		TickTimeElapsed = 0.f;
 		return;
 	}
 
-	if (TickRate > KINDA_SMALL_NUMBER)
+	// Fixed step. Keep the remainder and drop steps we can't catch up with. Throttling lengthens the step
+	int32 Steps = FMath::FloorToInt32(TickTimeElapsed / Interval);
+	TickTimeElapsed -= Steps * Interval;
+	Steps = FMath::Min(Steps, FMath::Max(1, MaxCatchUpSteps));
+
+	if (TickMode == EActionTickMode::FixedSubStep)
 	{
-		TickTimeElapsed += DeltaTime;
-		if (TickTimeElapsed < TickRate)
+		for (int32 Step = 0; Step < Steps; ++Step)
 		{
-			return;
+			DelayedTick(Interval);
 		}
-
-		// Delayed Tick
-		DelayedTick(TickTimeElapsed);
-
-		TickTimeElapsed = 0.f;
 	}
 	else
 	{
-		// Normal Tick
-		DelayedTick(DeltaTime);
+		DelayedTick(Steps * Interval);
 	}
 }
 
 void FActionsTickGroup::DelayedTick(float DeltaTime)
 {
-	for (int32 i = 0; i < Actions.Num(); ++i)
+	// Actions leave their group through their slot, never while it ticks. Groups don't hold null entries
+	int32 NumTicked = 0;
+	for (UAction* const Action : Actions)
 	{
-		auto* const Action = Actions[i];
-		if (!Action)
-		{
-			Actions.RemoveAtSwap(i, 1, EAllowShrinking::No);
-			--i;
-		}
-		else if (Action->CanTick())
+		checkSlow(IsValid(Action));
+		if (Action->CanTick())
 		{
-			Action->DoTick(DeltaTime);
+			Action->DoTick(DeltaTime * Action->GetTimeDilation());
+			++NumTicked;
 		}
 	}
+	INC_DWORD_STAT_BY(STAT_ActionTicks, NumTicked);
 }
 
 void FActionOwner::CancelAll(bool bShouldShrink)
 {
-	for (auto& Action : Actions)
+	// Queued actions are dropped first so that cancelled actions don't start them
+	ClearChannelQueues();
+
+	// Actions are moved out so that cancelling them doesn't modify the array being iterated
+	auto CancelledActions = MoveTemp(Actions);
+	for (auto& Action : CancelledActions)
 	{
 		if (Action)
 		{
@@ -78,62 +209,323 @@ void FActionOwner::CancelAll(bool bShouldShrink)
 
 void FActionOwner::CancelByPredicate(const TFunctionRef<bool(const UAction*)>& Predicate, bool bShouldShrink)
 {
-	for (int32 i = 0; i < Actions.Num(); ++i)
+	// Actions are removed before cancelling them so they don't look for themselves. Cancelling can add owners,
+	// moving this one, so it is not touched after
+	TArray<UAction*, TInlineAllocator<NumInlineActions>> CancelledActions;
+	Actions.RemoveAllSwap(
+		[&Predicate, &CancelledActions](UAction* Action) {
+			if (Action && Predicate(Action))
+			{
+				CancelledActions.Add(Action);
+				return true;
+			}
+			return false;
+		},
+		EAllowShrinking::No);
+
+	if (bShouldShrink)
+	{
+		Actions.Shrink();
+	}
+
+	for (UAction* Action : CancelledActions)
+	{
+		Action->Cancel();
+	}
+}
+
+void FActionOwner::ClearChannelQueues()
+{
+	for (auto& It : Channels)
 	{
-		auto* Action = Actions[i].Get();
-		if (Action && Predicate(Action))
+		TRingBuffer<FQueuedAction> Queue = MoveTemp(It.Value.Queue);
+		for (FQueuedAction& Queued : Queue)
 		{
-			// Cancel action
-			Action->Cancel();
+			Queued.OnCreated.ExecuteIfBound(nullptr);
+		}
+	}
+}
 
-			// Remove action
-			Actions.RemoveAtSwap(i, 1, EAllowShrinking::No);
-			--i;
+bool FActionOwner::HasActiveChannels() const
+{
+	for (const auto& It : Channels)
+	{
+		if (It.Value.IsActive())
+		{
+			return true;
 		}
 	}
+	return false;
+}
 
-	if (bShouldShrink)
+void FActionOwner::PruneClassSlots(double Time)
+{
+	for (auto It = ClassSlots.CreateIterator(); It; ++It)
 	{
-		Actions.Shrink();
+		if (!It.Value().Action && Time >= It.Value().DebounceEndTime)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FActionOwner::AddTags(const FGameplayTagContainer& TagsWithParents)
+{
+	for (const FGameplayTag& Tag : TagsWithParents)
+	{
+		++TagCounts.FindOrAdd(Tag);
+	}
+}
+
+void FActionOwner::RemoveTags(const FGameplayTagContainer& TagsWithParents)
+{
+	for (const FGameplayTag& Tag : TagsWithParents)
+	{
+		if (int32* Count = TagCounts.Find(Tag); Count && --(*Count) <= 0)
+		{
+			TagCounts.Remove(Tag);
+		}
+	}
+}
+
+bool FActionOwner::HasAnyTags(const FGameplayTagContainer& Tags) const
+{
+	if (TagCounts.IsEmpty())
+	{
+		return false;
+	}
+	for (const FGameplayTag& Tag : Tags)
+	{
+		if (TagCounts.Contains(Tag))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FActionOwner::AddStructReferencedObjects(FReferenceCollector& Collector)
+{
+	// Actions are referenced by the subsystem's live actions
+	for (auto& It : Channels)
+	{
+		for (FQueuedAction& Queued : It.Value.Queue)
+		{
+			Collector.AddReferencedObject(Queued.Class);
+			Collector.AddReferencedObject(Queued.Template);
+		}
 	}
 }
 
+SIZE_T FActionClassDescriptor::GetAllocatedSize() const
+{
+	const auto GetTagsSize = [](const FGameplayTagContainer& Container) {
+		return Container.GetGameplayTagArray().GetAllocatedSize();
+	};
+	return sizeof(FActionClassDescriptor) + ClassChain.GetAllocatedSize() + GetTagsSize(Tags) +
+		   GetTagsSize(TagsWithParents);
+}
+
+
+bool FActionQuery::Matches(const UAction* Action) const
+{
+	return IsValid(Action) && (Action->IsRunning() || (bIncludePending && Action->IsPending())) &&
+		   (!Class || Action->IsA(Class)) &&
+		   (!Owner || Action->GetOwner() == Owner) && Action->GetTags().HasAll(RequiredTags) &&
+		   (AnyTags.IsEmpty() || Action->GetTags().HasAny(AnyTags));
+}
+
 
 void UActionsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	MaxPendingCreateRequests = GetDefault<UActionsSettings>()->MaxPendingCreateRequests;
+	PreloadActionClasses();
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddWeakLambda(this, [this](ULevel* Level, UWorld* World) {
+		OnLevelVisibilityChanged(Level, World, true);
+	});
+	LevelRemovedHandle =
+		FWorldDelegates::LevelRemovedFromWorld.AddWeakLambda(this, [this](ULevel* Level, UWorld* World) {
+			OnLevelVisibilityChanged(Level, World, false);
+		});
 }
 
 void UActionsSubsystem::Deinitialize()
 {
-	CancelAll();
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	FTSTicker::GetCoreTicker().RemoveTicker(TeardownTickerHandle);
+	TeardownTickerHandle.Reset();
+
+	// Pending requests are dropped. Their callbacks are told no action was created
+	FActionCreateRequest Request;
+	while (CreateRequests.Dequeue(Request))
+	{
+		if (Request.OnCreated)
+		{
+			Request.OnCreated(nullptr);
+		}
+	}
+	NumPendingCreateRequests = 0;
+
+	TMap<FSoftObjectPath, FActionClassLoadRequest> LoadRequests = MoveTemp(ClassLoadRequests);
+	ClassLoadRequests.Reset();
+	for (auto& It : LoadRequests)
+	{
+		if (It.Value.Handle.IsValid())
+		{
+			It.Value.Handle->CancelHandle();
+		}
+		for (FPendingAsyncAction& PendingAction : It.Value.PendingActions)
+		{
+			PendingAction.OnCreated.ExecuteIfBound(nullptr);
+		}
+	}
+
+	if (PreloadHandle.IsValid())
+	{
+		PreloadHandle->ReleaseHandle();
+		PreloadHandle.Reset();
+	}
+
+	if (GetDefault<UActionsSettings>()->bReleaseActionsOnWorldTeardown)
+	{
+		ReleaseAll();
+	}
+	else
+	{
+		CancelAll();
+		ProcessTeardowns();
+	}
+	ClassDescriptors.Empty();
 	Super::Deinitialize();
 }
 
 bool UActionsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
 {
-	switch (WorldType)
+	return GetDefault<UActionsSettings>()->SupportedWorldTypes.Contains(WorldType);
+}
+
+void UActionsSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ActionsTick);
+
+	ProcessCreateRequests();
+
+	// While paused only actions ticking when paused are visited
+	const bool bPaused = GetWorld()->IsPaused();
+	const float DilatedDeltaTime = DeltaTime * GetWorld()->GetWorldSettings()->GetEffectiveTimeDilation();
+	if (!bPaused)
 	{
-		case EWorldType::Game:
-		case EWorldType::Editor:
-		case EWorldType::PIE:
-		case EWorldType::EditorPreview:
-		case EWorldType::GamePreview:
-		case EWorldType::GameRPC:
-		case EWorldType::Inactive:
-			return true;
+		// Deferred activations wait for the world to resume
+		ProcessPendingActivations();
+		SweepOwners();
+		UpdateSignificance(DeltaTime);
+		UpdateThrottle(DilatedDeltaTime);
 	}
-	return false;
+
+	// Tick all tick groups. Changes to the groups while ticking are deferred until all groups ticked
+	// Paused world time is not dilated
+	const float PausedLaneDeltaTime = bPaused ? DeltaTime : DilatedDeltaTime;
+	{
+		TGuardValue<bool> TickingGuard(bTickingGroups, true);
+		const float TickBudget = GetDefault<UActionsSettings>()->TickBudget * 0.001f;
+		if (TickBudget > 0.f)
+		{
+			TickGroupsInBudget(DilatedDeltaTime, PausedLaneDeltaTime, bPaused, TickBudget);
+		}
+		else
+		{
+			if (!bPaused)
+			{
+				for (FActionsTickGroup& TickGroup : TickGroups)
+				{
+					TickGroup.Tick(DilatedDeltaTime);
+				}
+			}
+			for (FActionsTickGroup& TickGroup : PausedTickGroups)
+			{
+				TickGroup.Tick(PausedLaneDeltaTime);
+			}
+		}
+	}
+	ApplyTickCommands();
+	ProcessTeardowns();
+
+	RemoveEmptyTickGroups(TickGroups);
+	RemoveEmptyTickGroups(PausedTickGroups);
+	UpdateDormancyStats();
 }
 
-void UActionsSubsystem::Tick(float DeltaTime)
+void UActionsSubsystem::TickGroupsInBudget(
+	float DeltaTime, float PausedLaneDeltaTime, bool bPaused, float Budget)
+{
+	// Groups don't change while ticking, so pointers to them stay valid
+	TArray<FActionsTickGroup*, TInlineAllocator<32>> DueGroups;
+	auto AddDueGroups = [&DueGroups](TArray<FActionsTickGroup>& Lane, float LaneDeltaTime) {
+		for (FActionsTickGroup& TickGroup : Lane)
+		{
+			TickGroup.AddTime(LaneDeltaTime);
+			if (TickGroup.IsDue())
+			{
+				DueGroups.Add(&TickGroup);
+			}
+		}
+	};
+	if (!bPaused)
+	{
+		AddDueGroups(TickGroups, DeltaTime);
+	}
+	AddDueGroups(PausedTickGroups, PausedLaneDeltaTime);
+
+	// Highest priority first. Inside a priority, earliest deadline first
+	DueGroups.Sort([](const FActionsTickGroup& A, const FActionsTickGroup& B) {
+		return A.Priority != B.Priority ? A.Priority < B.Priority : A.GetSlack() < B.GetSlack();
+	});
+
+	const double EndTime = FPlatformTime::Seconds() + Budget;
+	for (FActionsTickGroup* TickGroup : DueGroups)
+	{
+		if (FPlatformTime::Seconds() > EndTime)
+		{
+			if (TickGroup->GetSlack() > 0.f)
+			{
+				// Deferred groups keep their elapsed time and tick with all of it later
+				IncDeferredGroupsStat(TickGroup->Priority);
+				continue;
+			}
+			INC_DWORD_STAT(STAT_ActionsLateGroups);
+		}
+		TickGroup->TickElapsed();
+	}
+}
+
+bool UActionsSubsystem::IsTickable() const
+{
+	// Worlds without actions don't tick. Polled every frame, so the first action wakes us up
+	return !ActionOwners.IsEmpty() || !TickGroups.IsEmpty() || !PausedTickGroups.IsEmpty() ||
+		   PendingActivations.Num() > PendingActivationsHead || !Teardowns.IsEmpty() ||
+		   NumPendingCreateRequests.load(std::memory_order_relaxed) > 0;
+}
+
+bool UActionsSubsystem::IsTickableWhenPaused() const
 {
-	// Cancel destroyed object actions or of which the outer is invalid
+	return !PausedTickGroups.IsEmpty() || !Teardowns.IsEmpty();
+}
+
+void UActionsSubsystem::SweepOwners()
+{
+	// Cancel destroyed object actions or of which the outer is invalid.
+	// They are cancelled after iterating since cancelling can create new actions
+	TArray<FActionOwner> DestroyedOwners;
+	const double Time = GetWorld()->GetTimeSeconds();
 	for (auto RootIt = ActionOwners.CreateIterator(); RootIt; ++RootIt)
 	{
 		if (!RootIt->Owner.IsValid())
 		{
-			RootIt->CancelAll(false);
+			DestroyedOwners.Add(MoveTemp(*RootIt));
 			RootIt.RemoveCurrent();
 		}
 		else
@@ -145,29 +537,39 @@ void UActionsSubsystem::Tick(float DeltaTime)
 				},
 				EAllowShrinking::No);
 
-			if (RootIt->Actions.Num() <= 0)
+			if (!RootIt->ClassSlots.IsEmpty())
+			{
+				RootIt->PruneClassSlots(Time);
+			}
+
+			// Owners with channels or debounce windows are kept. Suspended owners are not, or owners suspended
+			// once would keep the subsystem ticking forever
+			if (RootIt->Actions.Num() <= 0 && !RootIt->HasActiveChannels() && RootIt->ClassSlots.IsEmpty())
 			{
 				RootIt.RemoveCurrent();
 			}
+			else
+			{
+				UpdateOwnerTimeDilation(*RootIt);
+			}
 		}
 	}
-
-	// Tick all tick groups
-	const float TimeDilation = GetWorld()->GetWorldSettings()->GetEffectiveTimeDilation();
-	for (int32 i = 0; i < TickGroups.Num(); ++i)
+	for (FActionOwner& Owner : DestroyedOwners)
 	{
-		auto& TickGroup = TickGroups[i];
+		CancelRemovedOwner(Owner);
+	}
+}
 
-		TickGroup.Tick(DeltaTime * TimeDilation);
+void UActionsSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	Super::AddReferencedObjects(InThis, Collector);
 
-		if (TickGroup.Actions.Num() <= 0)
-		{
-			// Tick group is empty so we remove and ignore it
-			TickGroups.RemoveAtSwap(i, 1, EAllowShrinking::No);
-			--i;
-		}
-	}
-	TickGroups.Shrink();
+	// Actions leave this array by their index, and owners, tick groups and indices hold them raw. They must stay
+	// alive until teardown, even if marked as garbage, so the collector can't null them
+	UActionsSubsystem* This = CastChecked<UActionsSubsystem>(InThis);
+	Collector.AllowEliminatingReferences(false);
+	Collector.AddReferencedObjects(This->LiveActions, This);
+	Collector.AllowEliminatingReferences(true);
 }
 
 TStatId UActionsSubsystem::GetStatId() const
@@ -177,84 +579,1454 @@ TStatId UActionsSubsystem::GetStatId() const
 
 void UActionsSubsystem::CancelAll()
 {
-	for (auto& RootAction : ActionOwners)
+	CancelPendingActivations(nullptr);
+
+	// Owners are moved out since cancelling can add new ones
+	TSet<FActionOwner> CancelledOwners = MoveTemp(ActionOwners);
+	ActionOwners.Reset();
+	LastOwnerId = {};
+	for (FActionOwner& Owner : CancelledOwners)
 	{
-		RootAction.CancelAll(false);
+		CancelRemovedOwner(Owner);
 	}
-	ActionOwners.Reset();
+}
+
+void UActionsSubsystem::ReleaseAll()
+{
+	check(!bTickingGroups);
+	SCOPE_CYCLE_COUNTER(STAT_ActionsRelease);
+
+	// Gather every action once. Children are gathered from their parents
+	TArray<UAction*> Actions;
+	for (const FActionOwner& Owner : ActionOwners)
+	{
+		for (UAction* Action : Owner.Actions)
+		{
+			if (IsValid(Action))
+			{
+				Actions.Add(Action);
+			}
+		}
+	}
+	for (int32 i = PendingActivationsHead; i < PendingActivations.Num(); ++i)
+	{
+		if (UAction* Action = PendingActivations[i]; IsValid(Action))
+		{
+			Actions.Add(Action);
+		}
+	}
+	for (int32 i = 0; i < Actions.Num(); ++i)
+	{
+		for (UAction* Child : Actions[i]->ChildrenActions)
+		{
+			if (IsValid(Child))
+			{
+				Actions.Add(Child);
+			}
+		}
+	}
+
+	// Actions that need their callbacks finish normally. Their children too
+	for (UAction* Action : Actions)
+	{
+		if (Action->GetFinishOnRelease() && IsValid(Action) && !Action->bPendingTeardown)
+		{
+			Action->Cancel();
+		}
+	}
+	ProcessTeardowns();
+
+	UWorld* const World = GetWorld();
+	for (UAction* Action : Actions)
+	{
+		if (!IsValid(Action))
+		{
+			continue;	 // Already finished
+		}
+
+		// Timers and latent actions could outlive the world
+		if (World)
+		{
+			FTimerManager& TimerManager = World->GetTimerManager();
+			for (FTimerHandle& Handle : Action->OwnedTimers)
+			{
+				TimerManager.ClearTimer(Handle);
+			}
+			TimerManager.ClearAllTimersForObject(Action);
+			World->GetLatentActionManager().RemoveActionsForObject(Action);
+		}
+
+		Action->State = EActionState::Cancelled;
+		Action->bPendingTeardown = true;
+		Action->bIndexed = false;
+		Action->OwnerId = {};
+		Action->TickGroupIndex = INDEX_NONE;
+		Action->TickGroupSlot = INDEX_NONE;
+		Action->ChildrenActions.Empty();
+		Action->OwnedTimers.Empty();
+		Action->LiveIndex = INDEX_NONE;
+		Action->Arena.Reset();
+		Action->MarkAsGarbage();
+	}
+	UE_LOG(LogActions, Verbose, TEXT("Released %d actions."), Actions.Num());
+
+	// Queued actions are dropped without notifying either
+	ActionOwners.Empty();
+	ActionsByClass.Empty();
+	ActionsByTag.Empty();
+	TickGroups.Empty();
+	PausedTickGroups.Empty();
+	TickCommands.Empty();
+	PendingActivations.Empty();
+	PendingActivationsHead = 0;
+	LiveActions.Empty();
+	LastOwnerId = {};
 }
 
 void UActionsSubsystem::CancelAllByOwner(UObject* Object)
 {
+	CancelPendingActivations(Object);
+
+	// The owner is moved out since cancelling can add owners, moving this one
 	const FSetElementId OwnerId = ActionOwners.FindId(Object);
 	if (OwnerId.IsValidId())
 	{
-		ActionOwners[OwnerId].CancelAll(false);
+		FActionOwner Owner = MoveTemp(ActionOwners[OwnerId]);
 		ActionOwners.Remove(OwnerId);
+		LastOwnerId = {};
+		CancelRemovedOwner(Owner);
 	}
 }
 
-void UActionsSubsystem::CancelByPredicate(TFunctionRef<bool(const UAction*)> Predicate)
+void UActionsSubsystem::SuspendAllByOwner(UObject* Object)
 {
-	for (auto& RootAction : ActionOwners)
+	if (FActionOwner* const Owner = ActionOwners.Find(Object))
 	{
-		RootAction.CancelByPredicate(Predicate);
+		const bool bWasSuspended = Owner->IsSuspended();
+		Owner->bSuspended = true;
+		OnOwnerSuspensionChanged(*Owner, bWasSuspended);
 	}
 }
 
-void UActionsSubsystem::CancelByOwnerPredicate(UObject* Object, TFunctionRef<bool(const UAction*)> Predicate)
+void UActionsSubsystem::ResumeAllByOwner(UObject* Object)
 {
 	if (FActionOwner* const Owner = ActionOwners.Find(Object))
 	{
-		Owner->CancelByPredicate(Predicate);
+		const bool bWasSuspended = Owner->IsSuspended();
+		Owner->bSuspended = false;
+		OnOwnerSuspensionChanged(*Owner, bWasSuspended);
 	}
 }
 
-void UActionsSubsystem::AddRootAction(UAction* Child)
+bool UActionsSubsystem::IsOwnerSuspended(UObject* Object) const
 {
-	check(Child);
-
-	// Registry for GC Canceling
-	UObject* Owner = Child->GetOuter();
+	const FActionOwner* const Owner = ActionOwners.Find(Object);
+	return Owner && Owner->IsSuspended();
+}
 
-	FSetElementId OwnerId = ActionOwners.FindId(Owner);
-	if (!OwnerId.IsValidId())
+void UActionsSubsystem::SetOwnerDormant(UObject* Object, bool bDormant)
+{
+	if (FActionOwner* const Owner = ActionOwners.Find(Object))
 	{
-		OwnerId = ActionOwners.Add({Owner});
+		const bool bWasSuspended = Owner->IsSuspended();
+		Owner->bDormant = bDormant;
+		OnOwnerSuspensionChanged(*Owner, bWasSuspended);
 	}
-	ActionOwners[OwnerId].Actions.Add(Child);
 }
 
-void UActionsSubsystem::AddActionToTickGroup(UAction* Child)
+void UActionsSubsystem::UpdateOwnerTimeDilation(FActionOwner& Owner)
 {
-	const float TickRate = Child->GetTickRate();
-
+	const float TimeDilation = GetOwnerTimeDilation(Owner.Owner.Get());
+	if (TimeDilation == Owner.TimeDilation)
+	{
+		return;
+	}
+	Owner.TimeDilation = TimeDilation;
+
+	TArray<UAction*, TInlineAllocator<16>> Pending;
+	Pending.Append(Owner.Actions);
+	while (!Pending.IsEmpty())
+	{
+		UAction* const Action = Pending.Pop(EAllowShrinking::No);
+		if (IsValid(Action))
+		{
+			Action->TimeDilation = TimeDilation;
+			Pending.Append(Action->ChildrenActions);
+		}
+	}
+}
+
+void UActionsSubsystem::OnLevelVisibilityChanged(ULevel* Level, UWorld* World, bool bVisible)
+{
+	// A null level means the whole world is being removed
+	if (!Level || World != GetWorld() || !GetDefault<UActionsSettings>()->bDormantInHiddenLevels)
+	{
+		return;
+	}
+
+	// Owners made dormant by hand stay dormant
+	for (FActionOwner& Owner : ActionOwners)
+	{
+		if (Owner.bLevelDormant != !bVisible && GetOwnerLevel(Owner.Owner.Get()) == Level)
+		{
+			const bool bWasSuspended = Owner.IsSuspended();
+			Owner.bLevelDormant = !bVisible;
+			OnOwnerSuspensionChanged(Owner, bWasSuspended);
+		}
+	}
+}
+
+void UActionsSubsystem::UpdateDormancyStats()
+{
+#if STATS
+	if (!FThreadStats::IsCollectingData())
+	{
+		return;
+	}
+
+	int32 NumDormantOwners = 0;
+	int32 NumDormantActions = 0;
+	int32 NumDormantTickingActions = 0;
+	TArray<UAction*, TInlineAllocator<16>> Pending;
+	for (const FActionOwner& Owner : ActionOwners)
+	{
+		if (!Owner.IsDormant())
+		{
+			continue;
+		}
+
+		++NumDormantOwners;
+		Pending.Append(Owner.Actions);
+		while (!Pending.IsEmpty())
+		{
+			UAction* const Action = Pending.Pop(EAllowShrinking::No);
+			if (IsValid(Action))
+			{
+				++NumDormantActions;
+				// Ticks this action would be doing if it wasn't dormant
+				NumDormantTickingActions += Action->GetWantsToTick();
+				Pending.Append(Action->ChildrenActions);
+			}
+		}
+	}
+	SET_DWORD_STAT(STAT_ActionsDormantOwners, NumDormantOwners);
+	SET_DWORD_STAT(STAT_ActionsDormant, NumDormantActions);
+	SET_DWORD_STAT(STAT_ActionsDormantTicking, NumDormantTickingActions);
+#endif
+}
+
+void UActionsSubsystem::CancelByPredicate(TFunctionRef<bool(const UAction*)> Predicate)
+{
+	// Gathered first since cancelling can add owners. Cancelled actions are removed from owners on teardown
+	TArray<UAction*> CancelledActions;
+	for (const FActionOwner& Owner : ActionOwners)
+	{
+		for (UAction* Action : Owner.Actions)
+		{
+			if (IsValid(Action) && Predicate(Action))
+			{
+				CancelledActions.Add(Action);
+			}
+		}
+	}
+	for (UAction* Action : CancelledActions)
+	{
+		Action->Cancel();
+	}
+}
+
+void UActionsSubsystem::CancelByOwnerPredicate(UObject* Object, TFunctionRef<bool(const UAction*)> Predicate)
+{
+	if (FActionOwner* const Owner = ActionOwners.Find(Object))
+	{
+		Owner->CancelByPredicate(Predicate);
+	}
+}
+
+void UActionsSubsystem::FindActions(const FActionQuery& Query, TArray<UAction*>& OutActions) const
+{
+	ForEachMatchingAction(Query, [&OutActions](UAction* Action) {
+		OutActions.Add(Action);
+		return true;
+	});
+}
+
+int32 UActionsSubsystem::CountActions(const FActionQuery& Query) const
+{
+	int32 Count = 0;
+	ForEachMatchingAction(Query, [&Count](UAction*) {
+		++Count;
+		return true;
+	});
+	return Count;
+}
+
+bool UActionsSubsystem::HasActionsWithTags(UObject* Owner, const FGameplayTagContainer& Tags) const
+{
+	const FActionOwner* const Entry = ActionOwners.Find(Owner);
+	return Entry && Entry->HasAnyTags(Tags);
+}
+
+int32 UActionsSubsystem::CancelActionsWithTags(UObject* Owner, const FGameplayTagContainer& Tags)
+{
+	if (Tags.IsEmpty() || !HasActionsWithTags(Owner, Tags))
+	{
+		return 0;
+	}
+
+	FActionQuery Query;
+	Query.Owner = Owner;
+	Query.AnyTags = Tags;
+	return CancelActions(Query);
+}
+
+int32 UActionsSubsystem::CancelActions(const FActionQuery& Query)
+{
+	// Cancelling modifies the indices, so actions are collected first
+	TArray<UAction*> Actions;
+	FindActions(Query, Actions);
+	for (UAction* Action : Actions)
+	{
+		Action->Cancel();
+	}
+	return Actions.Num();
+}
+
+bool UActionsSubsystem::RequestCreateAction(TWeakObjectPtr<UObject> Owner, TSubclassOf<UAction> Class,
+	TFunction<void(UAction*)> OnCreated, bool bAutoActivate)
+{
+	// Reserve a slot first so that concurrent requests can't exceed the limit
+	const int32 NumPending = NumPendingCreateRequests.fetch_add(1, std::memory_order_relaxed);
+	if (MaxPendingCreateRequests > 0 && NumPending >= MaxPendingCreateRequests)
+	{
+		NumPendingCreateRequests.fetch_sub(1, std::memory_order_relaxed);
+		INC_DWORD_STAT(STAT_ActionsRejectedRequests);
+		return false;
+	}
+
+	CreateRequests.Enqueue({MoveTemp(Owner), Class.Get(), MoveTemp(OnCreated), bAutoActivate});
+	return true;
+}
+
+void UActionsSubsystem::ProcessCreateRequests()
+{
+	check(IsInGameThread());
+	if (NumPendingCreateRequests.load(std::memory_order_relaxed) <= 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ActionsProcessCreateRequests);
+
+	const int32 MaxRequests = GetDefault<UActionsSettings>()->MaxCreateRequestsPerFrame;
+	int32 NumProcessed = 0;
+	FActionCreateRequest Request;
+	while ((MaxRequests <= 0 || NumProcessed < MaxRequests) && CreateRequests.Dequeue(Request))
+	{
+		NumPendingCreateRequests.fetch_sub(1, std::memory_order_relaxed);
+		++NumProcessed;
+
+		UAction* const Action = CreateAction(Request.Owner.Get(), Request.Class.Get(), false);
+		if (Request.OnCreated)
+		{
+			Request.OnCreated(Action);
+		}
+		if (Action && Request.bAutoActivate)
+		{
+			Action->Activate();
+		}
+	}
+	INC_DWORD_STAT_BY(STAT_ActionsCreatedFromRequests, NumProcessed);
+	SET_DWORD_STAT(STAT_ActionsPendingRequests, NumPendingCreateRequests.load(std::memory_order_relaxed));
+}
+
+void UActionsSubsystem::AddPendingActivation(UAction* Action)
+{
+	PendingActivations.Add(Action);
+}
+
+void UActionsSubsystem::ProcessPendingActivations()
+{
+	if (PendingActivationsHead >= PendingActivations.Num())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ActionsProcessActivations);
+
+	const UActionsSettings* Settings = GetDefault<UActionsSettings>();
+	const int32 MaxActivations =
+		Settings->MaxActivationsPerFrame > 0 ? Settings->MaxActivationsPerFrame : MAX_int32;
+	const double EndTime = Settings->ActivationBudget > 0.f
+							   ? FPlatformTime::Seconds() + Settings->ActivationBudget * 0.001
+							   : TNumericLimits<double>::Max();
+
+	// Actions can only be appended while activating. Those wait for the next frame
+	const int32 NumQueued = PendingActivations.Num();
+	int32 NumActivated = 0;
+	while (PendingActivationsHead < NumQueued && NumActivated < MaxActivations &&
+		   (NumActivated == 0 || FPlatformTime::Seconds() < EndTime))
+	{
+		UAction* const Action = PendingActivations[PendingActivationsHead++];
+		if (!IsValid(Action) || !Action->IsPending())
+		{
+			continue;	 // Cancelled while pending
+		}
+
+		// Owner or parent could have ended while this action waited
+		if (!IsValid(Action->GetOuter()) || Action->HasEndedParent())
+		{
+			Action->Cancel();
+			continue;
+		}
+
+		++NumActivated;
+		Action->StartActivation(this);
+	}
+	// Processed entries are only shifted out once they are at least half the queue
+	if (PendingActivationsHead >= PendingActivations.Num())
+	{
+		PendingActivations.Reset();
+		PendingActivationsHead = 0;
+	}
+	else if (PendingActivationsHead * 2 >= PendingActivations.Num())
+	{
+		PendingActivations.RemoveAt(0, PendingActivationsHead, EAllowShrinking::No);
+		PendingActivationsHead = 0;
+	}
+
+	INC_DWORD_STAT_BY(STAT_ActionsDeferredActivations, NumActivated);
+	SET_DWORD_STAT(STAT_ActionsPendingActivations, PendingActivations.Num() - PendingActivationsHead);
+}
+
+void UActionsSubsystem::CancelPendingActivations(const UObject* Owner)
+{
+	// Cancelled actions stay in the queue until processed, so it is never modified while being processed
+	for (int32 i = PendingActivationsHead; i < PendingActivations.Num(); ++i)
+	{
+		UAction* const Action = PendingActivations[i];
+		if (IsValid(Action) && Action->IsPending() && (!Owner || Action->GetOuter() == Owner))
+		{
+			Action->Cancel();
+		}
+	}
+}
+
+void UActionsSubsystem::RequestActionClass(
+	const TSoftClassPtr<UAction>& Class, FPendingAsyncAction&& PendingAction)
+{
+	const FSoftObjectPath& ClassPath = Class.ToSoftObjectPath();
+	if (FActionClassLoadRequest* Request = ClassLoadRequests.Find(ClassPath))
+	{
+		// Class is already being loaded
+		Request->PendingActions.Add(MoveTemp(PendingAction));
+		return;
+	}
+
+	ClassLoadRequests.Add(ClassPath).PendingActions.Add(MoveTemp(PendingAction));
+
+	// The load can complete immediately, so the request is only assigned its handle if still pending
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ClassPath,
+		FStreamableDelegate::CreateUObject(this, &UActionsSubsystem::OnActionClassLoaded, ClassPath),
+		FStreamableManager::AsyncLoadHighPriority);
+	if (FActionClassLoadRequest* Request = ClassLoadRequests.Find(ClassPath))
+	{
+		Request->Handle = MoveTemp(Handle);
+	}
+}
+
+void UActionsSubsystem::OnActionClassLoaded(FSoftObjectPath ClassPath)
+{
+	FActionClassLoadRequest Request;
+	if (!ClassLoadRequests.RemoveAndCopyValue(ClassPath, Request))
+	{
+		return;
+	}
+
+	UClass* const Class = TSoftClassPtr<UAction>(ClassPath).Get();
+	if (!Class)
+	{
+		UE_LOG(LogActions, Warning, TEXT("Could not load action class '%s'."), *ClassPath.ToString());
+	}
+
+	for (FPendingAsyncAction& PendingAction : Request.PendingActions)
+	{
+		UAction* Action = nullptr;
+		if (Class)
+		{
+			Action = CreateAction(PendingAction.Owner.Get(), Class, PendingAction.bAutoActivate);
+		}
+		PendingAction.OnCreated.ExecuteIfBound(Action);
+	}
+
+	if (Request.Handle.IsValid())
+	{
+		Request.Handle->ReleaseHandle();
+	}
+}
+
+void UActionsSubsystem::PreloadActionClasses()
+{
+	const UWorld* World = GetWorld();
+	if (!World || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	const FActionClassList* Preloaded = GetDefault<UActionsSettings>()->FindPreloadedClasses(World);
+	if (!Preloaded || Preloaded->Classes.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> ClassPaths;
+	ClassPaths.Reserve(Preloaded->Classes.Num());
+	for (const TSoftClassPtr<UAction>& Class : Preloaded->Classes)
+	{
+		if (!Class.IsNull())
+		{
+			ClassPaths.Add(Class.ToSoftObjectPath());
+		}
+	}
+	PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		MoveTemp(ClassPaths), FStreamableDelegate{}, FStreamableManager::AsyncLoadHighPriority);
+}
+
+void UActionsSubsystem::AddRootAction(UAction* Child)
+{
+	check(Child);
+
+	// Registry for GC Canceling
+	const FSetElementId OwnerId = FindOrAddOwner(Child->GetOuter());
+	FActionOwner& Owner = ActionOwners[OwnerId];
+	Owner.Actions.Add(Child);
+	Child->OwnerId = OwnerId;
+	Child->TimeDilation = Owner.TimeDilation;
+
+	if (Child->IsUniquenessTracked())
+	{
+		FActionClassSlot& Slot = Owner.ClassSlots.FindOrAdd(Child->GetClass());
+		Slot.Action = Child;
+		Slot.DebounceEndTime = GetWorld()->GetTimeSeconds() + Child->GetDebounceTime();
+	}
+
+	if (Owner.IsSuspended())
+	{
+		Child->AddSuspension();
+	}
+}
+
+FSetElementId UActionsSubsystem::FindOrAddOwner(UObject* Owner)
+{
+	// Actions are often added in bursts to the same owner
+	FSetElementId OwnerId = LastOwnerId;
+	if (!ActionOwners.IsValidId(OwnerId) || ActionOwners[OwnerId].Owner != Owner)
+	{
+		OwnerId = ActionOwners.FindId(Owner);
+		if (!OwnerId.IsValidId())
+		{
+			OwnerId = ActionOwners.Add({Owner});
+			ActionOwners[OwnerId].TimeDilation = GetOwnerTimeDilation(Owner);
+
+			const ULevel* Level = GetOwnerLevel(Owner);
+			if (Level && !Level->bIsVisible && GetDefault<UActionsSettings>()->bDormantInHiddenLevels)
+			{
+				ActionOwners[OwnerId].bLevelDormant = true;
+			}
+		}
+		LastOwnerId = OwnerId;
+	}
+	return OwnerId;
+}
+
+void UActionsSubsystem::ReserveActions(const UAction* Defaults, int32 Num, bool bActivated)
+{
+	ActionOwners.Reserve(ActionOwners.Num() + Num);
+
+	// Owners with reduced significance use other groups, but most actions go to the full rate one
+	if (bActivated && Defaults->GetWantsToTick() && !bTickingGroups)
+	{
+		const FActionsTickGroup Key{Defaults->GetTickRate(), Defaults->GetTickMode(), Defaults->GetPriority()};
+		FActionsTickGroup& Group = FindOrAddTickGroup(GetTickLane(Defaults), Key);
+		Group.Actions.Reserve(Group.Actions.Num() + Num);
+	}
+}
+
+bool UActionsSubsystem::ApplyUniqueness(
+	UObject* Owner, const UAction* Action, EActionUniquenessCheck Check, UAction*& OutExisting)
+{
+	OutExisting = nullptr;
+	if (!Action->IsUniquenessTracked())
+	{
+		return true;
+	}
+
+	FActionOwner* const Entry = ActionOwners.Find(Owner);
+	FActionClassSlot* const Slot = Entry ? Entry->ClassSlots.Find(Action->GetClass()) : nullptr;
+	if (!Slot)
+	{
+		return true;
+	}
+
+	if (GetWorld()->GetTimeSeconds() < Slot->DebounceEndTime)
+	{
+		INC_DWORD_STAT(STAT_ActionsDeduplicated);
+		return false;
+	}
+
+	UAction* const Existing = Slot->Action;
+	if (!IsValid(Existing) || !Existing->IsRunning() || Existing == Action)
+	{
+		return true;
+	}
+
+	switch (Action->GetUniqueness())
+	{
+		case EActionUniqueness::IgnoreNew:
+			INC_DWORD_STAT(STAT_ActionsDeduplicated);
+			return false;
+		case EActionUniqueness::RefreshExisting:
+			if (Check == EActionUniquenessCheck::Create)
+			{
+				return true;	// Refreshed if it activates while the other still runs
+			}
+			INC_DWORD_STAT(STAT_ActionsDeduplicated);
+			OutExisting = Existing;
+			Existing->OnRefresh();
+			return false;
+		case EActionUniqueness::ReplaceOld:
+			// Only once the new action activates, which can still fail
+			if (Check == EActionUniquenessCheck::Activate)
+			{
+				Existing->Cancel();
+			}
+			return true;
+		default:
+			return true;
+	}
+}
+
+UAction* UActionsSubsystem::CreateActionInChannel(
+	UObject* Owner, UClass* Class, const UAction* Template, FName Channel, FActionCreatedDelegate OnCreated)
+{
+	if (!IsValid(Owner) || (!Class && !Template))
+	{
+		OnCreated.ExecuteIfBound(nullptr);
+		return nullptr;
+	}
+
+	FActionChannel& ActionChannel = FindOrAddChannel(ActionOwners[FindOrAddOwner(Owner)], Channel);
+	if (ActionChannel.NumRunning >= ActionChannel.MaxConcurrency || !ActionChannel.Queue.IsEmpty())
+	{
+		// Queued actions are only created once they can start
+		ActionChannel.Queue.Add({Class, const_cast<UAction*>(Template), MoveTemp(OnCreated)});
+		return nullptr;
+	}
+	return StartChannelAction(Owner, Channel, Class, Template, OnCreated);
+}
+
+void UActionsSubsystem::SetChannelConcurrency(UObject* Object, FName Channel, int32 MaxConcurrency)
+{
+	if (!IsValid(Object))
+	{
+		return;
+	}
+
+	FActionChannel& ActionChannel = FindOrAddChannel(ActionOwners[FindOrAddOwner(Object)], Channel);
+	ActionChannel.MaxConcurrency = FMath::Max(1, MaxConcurrency);
+	ActionChannel.bCustomConcurrency = true;
+	DequeueChannelActions(Object, Channel);
+}
+
+int32 UActionsSubsystem::GetNumQueuedActions(UObject* Object, FName Channel) const
+{
+	const FActionOwner* const Owner = ActionOwners.Find(Object);
+	const FActionChannel* const ActionChannel = Owner ? Owner->Channels.Find(Channel) : nullptr;
+	return ActionChannel ? ActionChannel->Queue.Num() : 0;
+}
+
+UAction* UActionsSubsystem::GetUniqueAction(UObject* Object, TSubclassOf<UAction> Class) const
+{
+	const FActionOwner* const Owner = ActionOwners.Find(Object);
+	const FActionClassSlot* const Slot = Owner ? Owner->ClassSlots.Find(Class.Get()) : nullptr;
+	return Slot && IsValid(Slot->Action) && Slot->Action->IsRunning() ? Slot->Action : nullptr;
+}
+
+FActionChannel& UActionsSubsystem::FindOrAddChannel(FActionOwner& Owner, FName Channel)
+{
+	FActionChannel* ActionChannel = Owner.Channels.Find(Channel);
+	if (!ActionChannel)
+	{
+		ActionChannel = &Owner.Channels.Add(Channel);
+		ActionChannel->MaxConcurrency = GetDefault<UActionsSettings>()->GetChannelConcurrency(Channel);
+	}
+	return *ActionChannel;
+}
+
+FActionChannel* UActionsSubsystem::FindChannel(UObject* Owner, FName Channel)
+{
+	FActionOwner* const Entry = ActionOwners.Find(Owner);
+	return Entry ? Entry->Channels.Find(Channel) : nullptr;
+}
+
+UAction* UActionsSubsystem::StartChannelAction(
+	UObject* Owner, FName Channel, UClass* Class, const UAction* Template, FActionCreatedDelegate& OnCreated)
+{
+	UAction* Action = Template ? CreateAction(Owner, Template) : CreateAction(Owner, Class);
+	if (Action)
+	{
+		// The slot is taken before activating, so actions created during activation queue behind this one
+		++FindOrAddChannel(ActionOwners[FindOrAddOwner(Owner)], Channel).NumRunning;
+		Action->Channel = Channel;
+		if (!Action->Activate())
+		{
+			Action = nullptr;	 // Destroyed, which released the slot
+		}
+	}
+	OnCreated.ExecuteIfBound(Action);
+	return Action;
+}
+
+void UActionsSubsystem::ReleaseChannelSlot(UAction* Action)
+{
+	const FName Channel = Action->Channel;
+	Action->Channel = NAME_None;
+
+	UObject* const Owner = Action->GetOuter();
+	if (FActionChannel* const ActionChannel = FindChannel(Owner, Channel))
+	{
+		--ActionChannel->NumRunning;
+		DequeueChannelActions(Owner, Channel);
+	}
+}
+
+void UActionsSubsystem::DequeueChannelActions(UObject* Owner, FName Channel)
+{
+	FActionChannel* ActionChannel = FindChannel(Owner, Channel);
+	if (!ActionChannel || ActionChannel->bDequeuing)
+	{
+		return;	   // Slots freed while starting queued actions are filled by the outer call
+	}
+
+	ActionChannel->bDequeuing = true;
+	while (ActionChannel && ActionChannel->NumRunning < ActionChannel->MaxConcurrency &&
+		   !ActionChannel->Queue.IsEmpty())
+	{
+		FQueuedAction Queued = ActionChannel->Queue.PopFrontValue();
+		StartChannelAction(Owner, Channel, Queued.Class, Queued.Template, Queued.OnCreated);
+
+		// Starting actions can add owners or channels, moving this one
+		ActionChannel = FindChannel(Owner, Channel);
+	}
+
+	if (ActionChannel)
+	{
+		ActionChannel->bDequeuing = false;
+		if (!ActionChannel->IsActive())
+		{
+			ActionOwners.Find(Owner)->Channels.Remove(Channel);
+		}
+	}
+}
+
+void UActionsSubsystem::OnOwnerSuspensionChanged(FActionOwner& Owner, bool bWasSuspended)
+{
+	const bool bSuspended = Owner.IsSuspended();
+	if (bSuspended == bWasSuspended)
+	{
+		return;
+	}
+
+	// Actions can be cancelled while suspending or resuming, so we iterate a copy
+	const auto Actions = Owner.Actions;
+	for (UAction* Action : Actions)
+	{
+		if (IsValid(Action))
+		{
+			if (bSuspended)
+			{
+				Action->AddSuspension();
+			}
+			else
+			{
+				Action->RemoveSuspension();
+			}
+		}
+	}
+}
+
+void UActionsSubsystem::ReleaseClassSlot(UAction* Child)
+{
+	check(Child);
+
+	FActionOwner* const Owner = FindOwnerSlot(Child);
+	FActionClassSlot* const Slot = Owner ? Owner->ClassSlots.Find(Child->GetClass()) : nullptr;
+	if (Slot && Slot->Action == Child)
+	{
+		// Kept until its debounce ends
+		Slot->Action = nullptr;
+	}
+}
+
+void UActionsSubsystem::AddTeardown(UAction* Action)
+{
+	Action->bPendingTeardown = true;
+	Teardowns.Add(Action);
+
+	// Editor worlds don't tick game subsystems. Finished actions would be kept until the world is destroyed
+	if (!GetWorld()->IsGameWorld() && !TeardownTickerHandle.IsValid())
+	{
+		TeardownTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateWeakLambda(this, [this](float) {
+				TeardownTickerHandle.Reset();
+				ProcessTeardowns();
+				return false;
+			}));
+	}
+}
+
+void UActionsSubsystem::ProcessTeardowns()
+{
+	check(!bTickingGroups);
+	if (Teardowns.IsEmpty())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ActionsTeardown);
+
+	// Find every array holding destroyed actions, so each is compacted once however many actions it lost.
+	// Empty owners are removed on the next tick, so owner pointers stay valid.
+	// Most frames only tear down a few actions, so the sets rarely reach the heap
+	TSet<FActionOwner*, DefaultKeyFuncs<FActionOwner*>, TInlineSetAllocator<32>> Owners;
+	TSet<UAction*, DefaultKeyFuncs<UAction*>, TInlineSetAllocator<32>> Parents;
+	for (UAction* Action : Teardowns)
+	{
+		if (UAction* Parent = Action->GetParentAction())
+		{
+			// Destroyed parents already dropped their children
+			if (!Parent->bPendingTeardown)
+			{
+				Parents.Add(Parent);
+			}
+		}
+		else if (FActionOwner* const Owner = FindOwnerSlot(Action))
+		{
+			Owners.Add(Owner);
+		}
+
+		// Tick groups remove each action in O(1) with its slot
+		RemoveActionFromTickGroup(Action);
+	}
+
+	auto IsTornDown = [](const UAction* Action) {
+		return Action && Action->bPendingTeardown;
+	};
+	for (FActionOwner* Owner : Owners)
+	{
+		Owner->Actions.RemoveAllSwap(IsTornDown, EAllowShrinking::No);
+	}
+	for (UAction* Parent : Parents)
+	{
+		Parent->ChildrenActions.RemoveAllSwap(IsTornDown, EAllowShrinking::No);
+	}
+
+	// Root actions free the state of their whole tree in one step
+	for (UAction* Action : Teardowns)
+	{
+		RemoveLiveAction(Action);
+		Action->OwnerId = {};
+		Action->Arena.Reset();
+		Action->MarkAsGarbage();
+	}
+	INC_DWORD_STAT_BY(STAT_ActionsTornDown, Teardowns.Num());
+	Teardowns.Reset();
+}
+
+FActionOwner* UActionsSubsystem::FindOwnerSlot(const UAction* Action)
+{
+	// Only root actions are added to owners
+	while (const UAction* Parent = Action->GetParentAction())
+	{
+		Action = Parent;
+	}
+
+	const FSetElementId OwnerId = Action->OwnerId;
+	if (ActionOwners.IsValidId(OwnerId))
+	{
+		FActionOwner& Owner = ActionOwners[OwnerId];
+		// The slot could have been reused by another owner. Destroyed owners still match
+		if (Owner.Owner.HasSameIndexAndSerialNumber(Action->GetOuter()))
+		{
+			return &Owner;
+		}
+	}
+	return nullptr;
+}
+
+void UActionsSubsystem::CancelRemovedOwner(FActionOwner& Owner)
+{
+	// The freed slot can be reused by an owner added while cancelling, even the same object. Its tag counts,
+	// class slots and channels must not be touched by these actions
+	for (UAction* Action : Owner.Actions)
+	{
+		if (Action)
+		{
+			Action->OwnerId = {};
+			Action->Channel = NAME_None;
+		}
+	}
+	Owner.CancelAll(false);
+}
+
+void UActionsSubsystem::AddLiveAction(UAction* Action)
+{
+	if (Action->LiveIndex == INDEX_NONE)
+	{
+		Action->LiveIndex = LiveActions.Add(Action);
+	}
+}
+
+void UActionsSubsystem::RemoveLiveAction(UAction* Action)
+{
+	const int32 Index = Action->LiveIndex;
+	if (!LiveActions.IsValidIndex(Index) || LiveActions[Index] != Action)
+	{
+		return;
+	}
+
+	LiveActions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (LiveActions.IsValidIndex(Index) && LiveActions[Index])
+	{
+		LiveActions[Index]->LiveIndex = Index;
+	}
+	Action->LiveIndex = INDEX_NONE;
+}
+
+void UActionsSubsystem::AddActionToIndices(UAction* Action)
+{
+	if (Action->bIndexed)
+	{
+		return;
+	}
+	Action->bIndexed = true;
+	AddLiveAction(Action);
+
+	const FActionClassDescriptor& Descriptor = GetClassDescriptor(Action->GetClass());
+	for (const UClass* Class : Descriptor.ClassChain)
+	{
+		ActionsByClass.FindOrAdd(Class).Add(Action);
+	}
+
+	if (!Action->GetTags().IsEmpty())
+	{
+		FGameplayTagContainer OwnTags;
+		const FGameplayTagContainer& TagsWithParents = GetTagsWithParents(Action, Descriptor, OwnTags);
+		for (const FGameplayTag& Tag : TagsWithParents)
+		{
+			ActionsByTag.FindOrAdd(Tag).Add(Action);
+		}
+
+		if (FActionOwner* const Owner = FindOwnerSlot(Action))
+		{
+			Owner->AddTags(TagsWithParents);
+		}
+	}
+}
+
+void UActionsSubsystem::RemoveActionFromIndices(UAction* Action)
+{
+	if (!Action->bIndexed)
+	{
+		return;
+	}
+	Action->bIndexed = false;
+
+	const FActionClassDescriptor& Descriptor = GetClassDescriptor(Action->GetClass());
+	for (const UClass* Class : Descriptor.ClassChain)
+	{
+		if (TSet<UAction*>* Actions = ActionsByClass.Find(Class))
+		{
+			Actions->Remove(Action);
+			if (Actions->IsEmpty())
+			{
+				// Don't keep classes that could be unloaded
+				ActionsByClass.Remove(Class);
+			}
+		}
+	}
+
+	if (!Action->GetTags().IsEmpty())
+	{
+		FGameplayTagContainer OwnTags;
+		const FGameplayTagContainer& TagsWithParents = GetTagsWithParents(Action, Descriptor, OwnTags);
+		for (const FGameplayTag& Tag : TagsWithParents)
+		{
+			if (TSet<UAction*>* Actions = ActionsByTag.Find(Tag))
+			{
+				Actions->Remove(Action);
+				if (Actions->IsEmpty())
+				{
+					ActionsByTag.Remove(Tag);
+				}
+			}
+		}
+
+		if (FActionOwner* const Owner = FindOwnerSlot(Action))
+		{
+			Owner->RemoveTags(TagsWithParents);
+		}
+	}
+}
+
+void UActionsSubsystem::ForEachMatchingAction(
+	const FActionQuery& Query, TFunctionRef<bool(UAction*)> Callback) const
+{
+	// Pending actions are not indexed
+	if (Query.bIncludePending)
+	{
+		for (int32 i = PendingActivationsHead; i < PendingActivations.Num(); ++i)
+		{
+			UAction* const Action = PendingActivations[i];
+			if (Query.Matches(Action) && Action->IsPending() && !Callback(Action))
+			{
+				return;
+			}
+		}
+	}
+
+	if (Query.Owner)
+	{
+		// Owners run few actions, so their action trees are iterated directly
+		const FActionOwner* const Owner = ActionOwners.Find(Query.Owner.Get());
+		if (!Owner)
+		{
+			return;
+		}
+
+		TArray<UAction*, TInlineAllocator<16>> Pending;
+		for (UAction* Action : Owner->Actions)
+		{
+			Pending.Add(Action);
+		}
+		while (!Pending.IsEmpty())
+		{
+			UAction* const Action = Pending.Pop(EAllowShrinking::No);
+			if (!IsValid(Action))
+			{
+				continue;
+			}
+			if (Query.Matches(Action) && !Callback(Action))
+			{
+				return;
+			}
+			Pending.Append(Action->ChildrenActions);
+		}
+		return;
+	}
+
+	// Find the smallest index containing all possible matches
+	const UClass* const Class = Query.Class ? Query.Class.Get() : UAction::StaticClass();
+	const TSet<UAction*>* Candidates = ActionsByClass.Find(Class);
+	if (!Candidates)
+	{
+		return;
+	}
+	for (const FGameplayTag& Tag : Query.RequiredTags)
+	{
+		const TSet<UAction*>* TagCandidates = ActionsByTag.Find(Tag);
+		if (!TagCandidates)
+		{
+			return;
+		}
+		if (TagCandidates->Num() < Candidates->Num())
+		{
+			Candidates = TagCandidates;
+		}
+	}
+
+	for (UAction* Action : *Candidates)
+	{
+		if (Query.Matches(Action) && !Callback(Action))
+		{
+			return;
+		}
+	}
+}
+
+void UActionsSubsystem::AddActionToTickGroup(UAction* Child)
+{
+	if (bTickingGroups)
+	{
+		TickCommands.Add({Child, true});
+		return;
+	}
+
+	if (Child->TickGroupIndex != INDEX_NONE || Child->IsSuspended() || Child->bPendingTeardown)
+	{
+		return;	   // Already in a tick group or shouldn't tick
+	}
+
+	const FActionsTickGroup Key{GetScheduledTickRate(Child), Child->GetTickMode(), Child->GetPriority()};
+
 	// Registry for tick groups
-	FActionsTickGroup* Group = TickGroups.FindByKey(TickRate);
-	if (!Group)
+	TArray<FActionsTickGroup>& Lane = GetTickLane(Child);
+	FActionsTickGroup& Group = FindOrAddTickGroup(Lane, Key);
+	Child->TickGroupIndex = UE_PTRDIFF_TO_INT32(&Group - Lane.GetData());
+	Child->TickGroupSlot = Group.Actions.Add(Child);
+}
+
+FActionsTickGroup& UActionsSubsystem::FindOrAddTickGroup(
+	TArray<FActionsTickGroup>& Lane, const FActionsTickGroup& Key)
+{
+	if (FActionsTickGroup* Group = Lane.FindByKey(Key))
 	{
-		TickGroups.Add({TickRate});
-		Group = &TickGroups.Last();
+		return *Group;
 	}
 
-	Group->Actions.Add(Child);
+	const UActionsSettings* Settings = GetDefault<UActionsSettings>();
+	FActionsTickGroup& Group = Lane.Add_GetRef(Key);
+	Group.MaxCatchUpSteps = Settings->MaxTickCatchUpSteps;
+	Group.MaxTickDelay = Settings->GetMaxTickDelay(Key.Priority);
+	if (&Lane == &TickGroups)
+	{
+		ApplyThrottle(Group);
+	}
+	return Group;
 }
 
 void UActionsSubsystem::RemoveActionFromTickGroup(UAction* Child)
 {
-	const float TickRate = Child->GetTickRate();
-	int32 Index = TickGroups.Find(TickRate);
-	if (Index != INDEX_NONE)
+	if (bTickingGroups)
+	{
+		TickCommands.Add({Child, false});
+		return;
+	}
+
+	if (Child->TickGroupIndex == INDEX_NONE)
+	{
+		return;	   // Not in a tick group
+	}
+
+	// The group is found by index and not by the current tick rate, which could have changed since it was added.
+	// Empty groups are removed after ticking
+	TArray<UAction*>& Actions = GetTickLane(Child)[Child->TickGroupIndex].Actions;
+	const int32 Slot = Child->TickGroupSlot;
+	check(Actions[Slot] == Child);
+	Actions.RemoveAtSwap(Slot, EAllowShrinking::No);
+	if (Actions.IsValidIndex(Slot))
+	{
+		Actions[Slot]->TickGroupSlot = Slot;
+	}
+	Child->TickGroupIndex = INDEX_NONE;
+	Child->TickGroupSlot = INDEX_NONE;
+}
+
+void UActionsSubsystem::RescheduleAction(UAction* Action)
+{
+	if (Action->TickGroupIndex != INDEX_NONE)
+	{
+		RemoveActionFromTickGroup(Action);
+		AddActionToTickGroup(Action);
+	}
+}
+
+void UActionsSubsystem::RemoveEmptyTickGroups(TArray<FActionsTickGroup>& Lane)
+{
+	for (int32 i = Lane.Num() - 1; i >= 0; --i)
 	{
-		auto& Group = TickGroups[Index];
-		if (Group.Actions.Num() > 1)
+		if (Lane[i].Actions.IsEmpty())
 		{
-			Group.Actions.RemoveSwap(Child, EAllowShrinking::No);
+			Lane.RemoveAtSwap(i, EAllowShrinking::No);
+			if (Lane.IsValidIndex(i))
+			{
+				// The last group took its place
+				for (UAction* Action : Lane[i].Actions)
+				{
+					Action->TickGroupIndex = i;
+				}
+			}
 		}
-		else
+	}
+	Lane.Shrink();
+}
+
+TArray<FActionsTickGroup>& UActionsSubsystem::GetTickLane(const UAction* Action)
+{
+	return Action->GetTickWhenPaused() ? PausedTickGroups : TickGroups;
+}
+
+void UActionsSubsystem::ApplyTickCommands()
+{
+	check(!bTickingGroups);
+
+	// Commands are applied in order, so an action added and removed during the same tick ends up removed
+	for (const FActionsTickCommand& Command : TickCommands)
+	{
+		if (!Command.bAdd)
+		{
+			RemoveActionFromTickGroup(Command.Action);
+		}
+		else if (IsValid(Command.Action))	 // Could have finished during the tick
+		{
+			AddActionToTickGroup(Command.Action);
+		}
+	}
+	TickCommands.Reset();
+}
+
+float UActionsSubsystem::GetScheduledTickRate(const UAction* Action)
+{
+	const float TickRate = Action->GetTickRate();
+
+	const FActionOwner* const Owner = FindOwnerSlot(Action);
+	const TArray<FActionSignificanceTier>& Tiers = GetDefault<UActionsSettings>()->SignificanceTiers;
+	if (!Owner || !Tiers.IsValidIndex(Owner->SignificanceTier))
+	{
+		return TickRate;
+	}
+
+	const FActionSignificanceTier& Tier = Tiers[Owner->SignificanceTier];
+	const float ScaledTickRate = FMath::Max(TickRate * Tier.TickRateScale, Tier.MinTickRate);
+	// Same precision as UAction::GetTickRate so that actions share groups
+	return FMath::FloorToFloat(ScaledTickRate * 10000.f) * 0.0001f;
+}
+
+const FActionClassDescriptor& UActionsSubsystem::GetClassDescriptor(const UClass* Class)
+{
+	check(Class && Class->IsChildOf<UAction>());
+	TUniquePtr<FActionClassDescriptor>& Descriptor = ClassDescriptors.FindOrAdd(Class);
+	if (Descriptor)
+	{
+		return *Descriptor;
+	}
+
+	Descriptor = MakeUnique<FActionClassDescriptor>();
+	for (const UClass* Parent = Class; Parent; Parent = Parent->GetSuperClass())
+	{
+		Descriptor->ClassChain.Add(Parent);
+		if (Parent == UAction::StaticClass())
+		{
+			break;
+		}
+	}
+
+	const UAction* Defaults = Class->GetDefaultObject<UAction>();
+	Descriptor->Tags = Defaults->Tags;
+	Descriptor->TagsWithParents = Defaults->Tags.GetGameplayTagParents();
+	return *Descriptor;
+}
+
+void UActionsSubsystem::DumpMemoryReport(FOutputDevice& Ar) const
+{
+	struct FClassMemory
+	{
+		int32 Num = 0;
+		SIZE_T InstanceSize = 0;
+		SIZE_T HeapSize = 0;
+	};
+	TMap<const UClass*, FClassMemory> Classes;
+	SIZE_T TotalSize = 0;
+	for (const UAction* Action : LiveActions)
+	{
+		if (!Action)
+		{
+			continue;
+		}
+
+		FClassMemory& Memory = Classes.FindOrAdd(Action->GetClass());
+		++Memory.Num;
+		Memory.InstanceSize = Action->GetClass()->GetStructureSize();
+		Memory.HeapSize += Action->GetAllocatedSize();
+		TotalSize += Memory.InstanceSize + Action->GetAllocatedSize();
+	}
+	Classes.ValueSort([](const FClassMemory& A, const FClassMemory& B) {
+		return A.Num * A.InstanceSize + A.HeapSize > B.Num * B.InstanceSize + B.HeapSize;
+	});
+
+	SIZE_T SharedSize = 0;
+	for (const auto& It : ClassDescriptors)
+	{
+		SharedSize += It.Value->GetAllocatedSize();
+	}
+
+	Ar.Logf(TEXT("%d running actions use %.1f KB. Index data of %d classes uses %.1f KB"),
+		LiveActions.Num(), TotalSize / 1024.f, ClassDescriptors.Num(), SharedSize / 1024.f);
+	Ar.Logf(TEXT("%8s %10s %10s %10s  %s"), TEXT("Count"), TEXT("Instance"), TEXT("Heap/Act"), TEXT("Total KB"),
+		TEXT("Class"));
+	for (const auto& It : Classes)
+	{
+		const FClassMemory& Memory = It.Value;
+		Ar.Logf(TEXT("%8d %10llu %10llu %10.1f  %s"), Memory.Num, (uint64) Memory.InstanceSize,
+			(uint64) (Memory.HeapSize / Memory.Num), (Memory.Num * Memory.InstanceSize + Memory.HeapSize) / 1024.f,
+			*It.Key->GetName());
+	}
+}
+
+void UActionsSubsystem::UpdateThrottle(float DeltaTime)
+{
+	const UActionsSettings* Settings = GetDefault<UActionsSettings>();
+	const int32 ThrottleOverride = CVarThrottle.GetValueOnGameThread();
+	const float LastScale = ThrottleScale;
+	if (ThrottleOverride < 0 ? !Settings->bEnableThrottling : ThrottleOverride == 0)
+	{
+		SmoothedFrameTime = 0.f;
+		SmoothedDeltaTime = 0.f;
+		ThrottleScale = 1.f;
+	}
+	else
+	{
+		// Time waiting for the next server frame is not load
+		const float RealDeltaTime = float(FApp::GetDeltaTime());
+		const float FrameTime = FMath::Max(0.f, RealDeltaTime - float(FApp::GetIdleTime()));
+		const float Alpha = Settings->ThrottleSmoothingTime > 0.f
+							  ? FMath::Min(1.f, RealDeltaTime / Settings->ThrottleSmoothingTime)
+							  : 1.f;
+		SmoothedFrameTime = SmoothedFrameTime > 0.f ? FMath::Lerp(SmoothedFrameTime, FrameTime, Alpha) : FrameTime;
+		SmoothedDeltaTime = SmoothedDeltaTime > 0.f ? FMath::Lerp(SmoothedDeltaTime, DeltaTime, Alpha) : DeltaTime;
+
+		const float TargetOverride = CVarThrottleTargetFrameTime.GetValueOnGameThread();
+		const float TargetFrameTime =
+			(TargetOverride > 0.f ? TargetOverride : Settings->ThrottleTargetFrameTime) * 0.001f;
+		if (TargetFrameTime > 0.f)
+		{
+			// The scale accumulates the relative error, so it keeps growing while over target and only goes back
+			// to 1 once frames are cheaper than the target
+			const float Error = SmoothedFrameTime / TargetFrameTime - 1.f;
+			ThrottleScale = FMath::Clamp(ThrottleScale + Error * Settings->ThrottleResponse * RealDeltaTime, 1.f,
+				Settings->GetMaxThrottleScale());
+		}
+	}
+
+	if (LastScale > 1.f && ThrottleScale <= 1.f)
+	{
+		UE_LOG(LogActions, Verbose, TEXT("Stopped throttling actions."));
+	}
+	else if (LastScale <= 1.f && ThrottleScale > 1.f)
+	{
+		UE_LOG(LogActions, Verbose, TEXT("Throttling actions. Frame time: %.2fms"), SmoothedFrameTime * 1000.f);
+	}
+
+	// Throttled groups ticking every frame follow the delta time, so they are updated while throttling
+	int32 NumThrottled = 0;
+	if (ThrottleScale != LastScale || ThrottleScale > 1.f)
+	{
+		for (FActionsTickGroup& Group : TickGroups)
+		{
+			ApplyThrottle(Group);
+			NumThrottled += Group.Interval > Group.TickRate;
+		}
+	}
+	SET_FLOAT_STAT(STAT_ActionsThrottleScale, ThrottleScale);
+	SET_FLOAT_STAT(STAT_ActionsFrameTime, SmoothedFrameTime * 1000.f);
+	SET_DWORD_STAT(STAT_ActionsThrottledGroups, NumThrottled);
+}
+
+void UActionsSubsystem::ApplyThrottle(FActionsTickGroup& Group) const
+{
+	const float Scale =
+		FMath::Min(ThrottleScale, GetDefault<UActionsSettings>()->GetMaxThrottleScale(Group.Priority));
+	Group.Interval = Scale > 1.f ? FMath::Max(Group.TickRate, SmoothedDeltaTime) * Scale : Group.TickRate;
+}
+
+float UActionsSubsystem::GetTickInterval(const UAction* Action) const
+{
+	if (!Action || Action->TickGroupIndex == INDEX_NONE)
+	{
+		return -1.f;
+	}
+	const TArray<FActionsTickGroup>& Lane = Action->GetTickWhenPaused() ? PausedTickGroups : TickGroups;
+	return Lane[Action->TickGroupIndex].Interval;
+}
+
+void UActionsSubsystem::SetSignificanceProvider(FActionSignificanceDelegate Provider)
+{
+	SignificanceDelegate = MoveTemp(Provider);
+}
+
+void UActionsSubsystem::UpdateSignificance(float DeltaTime)
+{
+	const UActionsSettings* Settings = GetDefault<UActionsSettings>();
+	if (!Settings->bEnableSignificance || Settings->SignificanceTiers.IsEmpty())
+	{
+		return;
+	}
+
+	SignificanceTimeElapsed += DeltaTime;
+	if (SignificanceTimeElapsed < Settings->SignificanceUpdateInterval)
+	{
+		return;
+	}
+	SignificanceTimeElapsed = 0.f;
+
+	SCOPE_CYCLE_COUNTER(STAT_ActionsUpdateSignificance);
+
+	int32 NumReducedRateOwners = 0;
+	for (FActionOwner& Owner : ActionOwners)
+	{
+		const float Significance = GetOwnerSignificance(Owner.Owner.Get());
+		const int32 Tier = Significance < 0.f ? INDEX_NONE : Settings->FindSignificanceTier(Significance);
+		if (Tier != Owner.SignificanceTier)
+		{
+			// Owner changed tier, its actions move to groups of their new tick rate
+			Owner.SignificanceTier = Tier;
+			RescheduleOwner(Owner);
+		}
+
+		if (Tier > 0)
+		{
+			++NumReducedRateOwners;
+		}
+	}
+	SET_DWORD_STAT(STAT_ActionsReducedRateOwners, NumReducedRateOwners);
+}
+
+float UActionsSubsystem::GetOwnerSignificance(const UObject* Owner) const
+{
+	if (!Owner)
+	{
+		return -1.f;
+	}
+
+	if (SignificanceDelegate.IsBound())
+	{
+		return SignificanceDelegate.Execute(Owner);
+	}
+
+#if WITH_SIGNIFICANCE_MANAGER
+	const USignificanceManager* Manager = USignificanceManager::Get(GetWorld());
+	if (!Manager)
+	{
+		return -1.f;
+	}
+
+	// Significance is usually tracked for actors, so components use their actor's
+	if (const UActorComponent* Component = Cast<UActorComponent>(Owner))
+	{
+		Owner = Component->GetOwner();
+	}
+
+	float Significance = 0.f;
+	return Manager->QueryObjectSignificance(Owner, Significance) ? Significance : -1.f;
+#else
+	return -1.f;
+#endif	  // WITH_SIGNIFICANCE_MANAGER
+}
+
+void UActionsSubsystem::RescheduleOwner(const FActionOwner& Owner)
+{
+	TArray<UAction*, TInlineAllocator<16>> Pending;
+	Pending.Append(Owner.Actions);
+	while (!Pending.IsEmpty())
+	{
+		UAction* const Action = Pending.Pop(EAllowShrinking::No);
+		if (!IsValid(Action))
 		{
-			TickGroups.RemoveAtSwap(Index);
+			continue;
 		}
+
+		RescheduleAction(Action);
+		Pending.Append(Action->ChildrenActions);
 	}
 }
 
@@ -14,13 +14,26 @@ EBTNodeResult::Type UBTT_RunAction::ExecuteTask(UBehaviorTreeComponent& InOwnerC
 	check(OwnerActor);
 
 	Action = CreateAction(OwnerActor, ActionType, false);
-	check(Action);
+	if (!Action)
+	{
+		return EBTNodeResult::Failed;	 // Ignored by the uniqueness of the action
+	}
 
-	Action->OnFinishedDelegate.AddDynamic(this, &UBTT_RunAction::OnRunActionFinished);
-	Action->Activate();
+	Action->OnFinishedDelegate.AddUniqueDynamic(this, &UBTT_RunAction::OnRunActionFinished);
+
+	// Finishing while activating is returned instead of finishing the latent task
+	OwnerComp = nullptr;
+	if (!Action->Activate())
+	{
+		return EBTNodeResult::Failed;	 // Blocked by tags, refused or failed right away
+	}
+	if (Action->Succeeded())
+	{
+		return EBTNodeResult::Succeeded;
+	}
 
 	OwnerComp = &InOwnerComp;
-	return Action ? EBTNodeResult::InProgress : EBTNodeResult::Failed;
+	return EBTNodeResult::InProgress;
 }
 
 EBTNodeResult::Type UBTT_RunAction::AbortTask(UBehaviorTreeComponent& InOwnerComp, uint8* NodeMemory)
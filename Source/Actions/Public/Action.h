@@ -2,12 +2,15 @@
 
 #pragma once
 
+#include "ActionArena.h"
 #include "ActionsSubsystem.h"
 
 #include <CoreMinimal.h>
 #include <Engine/GameInstance.h>
 #include <Engine/World.h>
+#include <GameplayTagContainer.h>
 #include <Tickable.h>
+#include <TimerManager.h>
 #include <UObject/ObjectMacros.h>
 #include <UObject/ScriptInterface.h>
 
@@ -24,6 +27,8 @@ class UAction;
  * @param Owner of the action. If destroyed, the action will follow.
  * @param Class of the action to create
  * @param bAutoActivate if true activates the action. If false, Action->Activate() can be called later.
+ * @return the new action. Null if its uniqueness policy ignored it or, when activated, refreshed the running
+ * one instead. UActionsSubsystem::GetUniqueAction returns the refreshed action.
  */
 ACTIONSEXTENSION_API UAction* CreateAction(
 	UObject* Owner, const TSubclassOf<UAction> Class, bool bAutoActivate = false);
@@ -33,10 +38,67 @@ ACTIONSEXTENSION_API UAction* CreateAction(
  * @param Owner of the action. If destroyed, the action will follow.
  * @param Template whose properties and class are used to create the action.
  * @param bAutoActivate if true activates the action. If false, Action->Activate() can be called later.
+ * @return the new action. Null if its uniqueness policy ignored it or, when activated, refreshed the running
+ * one instead. UActionsSubsystem::GetUniqueAction returns the refreshed action.
  */
 ACTIONSEXTENSION_API UAction* CreateAction(
 	UObject* Owner, const UAction* Template, bool bAutoActivate = false);
 
+/**
+ * Creates a new action of the same class for each owner. Cheaper than calling CreateAction in a loop, since
+ * class data is resolved once and subsystem containers are reserved for all actions up front.
+ * @param Owners of the actions. One action is created for each.
+ * @param Class of the actions to create
+ * @param bAutoActivate if true activates the actions.
+ * @return an action for each owner in the same order. Null where it could not be created.
+ */
+ACTIONSEXTENSION_API TArray<UAction*> CreateActions(
+	TArrayView<UObject* const> Owners, const TSubclassOf<UAction> Class, bool bAutoActivate = false);
+
+/**
+ * Creates a new action from the same template for each owner. Cheaper than calling CreateAction in a loop.
+ * @param Owners of the actions. One action is created for each.
+ * @param Template whose properties and class are used to create the actions.
+ * @param bAutoActivate if true activates the actions.
+ * @return an action for each owner in the same order. Null where it could not be created.
+ */
+ACTIONSEXTENSION_API TArray<UAction*> CreateActions(
+	TArrayView<UObject* const> Owners, const UAction* Template, bool bAutoActivate = false);
+
+/**
+ * Creates a new action once its class is loaded, streaming it if needed.
+ * Requests of a class that is already being streamed share the same load.
+ * @param Owner of the action. If destroyed before the class is loaded, no action is created.
+ * @param Class soft reference to the class of the action to create
+ * @param bAutoActivate if true activates the action as soon as it is created.
+ * @param OnCreated called with the new action, or with nullptr if it could not be created.
+ */
+ACTIONSEXTENSION_API void CreateActionAsync(UObject* Owner, const TSoftClassPtr<UAction>& Class,
+	bool bAutoActivate = true, FActionCreatedDelegate OnCreated = {});
+
+/**
+ * Creates and activates an action in a channel of its owner. If the channel already runs its max number of
+ * actions, the action is queued and only created once a running action of that channel ends.
+ * @param Owner of the action. Each owner has its own channels.
+ * @param Class of the action to create
+ * @param Channel limiting how many actions run at once. Configured in settings or with SetChannelConcurrency
+ * @param OnCreated called with the new action once it starts, or with nullptr if it could not start.
+ * @return the action if it started immediately
+ */
+ACTIONSEXTENSION_API UAction* CreateActionInChannel(UObject* Owner, const TSubclassOf<UAction> Class,
+	FName Channel, FActionCreatedDelegate OnCreated = {});
+
+/**
+ * Creates and activates an action in a channel of its owner, or queues it if the channel is full.
+ * @param Owner of the action. Each owner has its own channels.
+ * @param Template whose properties and class are used to create the action. Kept alive while queued.
+ * @param Channel limiting how many actions run at once. Configured in settings or with SetChannelConcurrency
+ * @param OnCreated called with the new action once it starts, or with nullptr if it could not start.
+ * @return the action if it started immediately
+ */
+ACTIONSEXTENSION_API UAction* CreateActionInChannel(
+	UObject* Owner, const UAction* Template, FName Channel, FActionCreatedDelegate OnCreated = {});
+
 /**
  * Creates a new action. Templated version
  * @param ActionType
@@ -76,7 +138,25 @@ enum class EActionState : uint8
 	Running UMETA(Hidden),
 	Success,
 	Failure,
-	Cancelled
+	Cancelled,
+	/** Waiting in the subsystem to be activated. Only actions with deferred activation */
+	Pending UMETA(Hidden)
+};
+
+/**
+ * What happens when an owner creates an action of a class it is already running
+ */
+UENUM()
+enum class EActionUniqueness : uint8
+{
+	/** Any number of actions of the class can run */
+	None,
+	/** The new action is not created */
+	IgnoreNew,
+	/** The running action is cancelled when the new one activates */
+	ReplaceOld,
+	/** The new action doesn't activate. The running action is refreshed instead when it would */
+	RefreshExisting
 };
 
 inline FString ToString(EActionState Value)
@@ -98,6 +178,8 @@ class ACTIONSEXTENSION_API UAction : public UObject
 {
 	GENERATED_BODY()
 
+	friend UActionsSubsystem;
+
 	/************************************************************************/
 	/* PROPERTIES														    */
 	/************************************************************************/
@@ -111,6 +193,46 @@ private:
 	UPROPERTY(SaveGame)
 	TArray<UAction*> ChildrenActions;
 
+	/** Id of the subsystem owner entry this root action was added to. Cached to avoid hashing it again. */
+	FSetElementId OwnerId;
+
+	/** True while the action is registered in the subsystem query indices */
+	bool bIndexed = false;
+
+	/** Index in the live actions of the subsystem. None while not running */
+	int32 LiveIndex = INDEX_NONE;
+
+	/** True once destroyed, until the subsystem tears it down at the end of its tick */
+	bool bPendingTeardown = false;
+
+	/** Index of the tick group this action is in, inside its tick lane. None while not in a tick group */
+	int32 TickGroupIndex = INDEX_NONE;
+
+	/** Index of this action in the actions of its tick group. Lets it leave the group in O(1) */
+	int32 TickGroupSlot = INDEX_NONE;
+
+	/** True if Suspend was called on this action */
+	bool bSuspended = false;
+
+	/** Number of reasons this action is suspended: itself, its parent or its owner */
+	uint8 SuspensionCount = 0;
+
+	/** Timers started with SetTimer. They are paused while suspended */
+	TArray<FTimerHandle> OwnedTimers;
+
+	/** Custom time dilation of the owner actor, applied to tick delta */
+	float TimeDilation = 1.f;
+
+	/** Native state of this action tree. Only root actions have one, created on first use */
+	TUniquePtr<FActionArena> Arena;
+
+	/** Channel of its owner this action holds a slot in. None if not created in a channel */
+	FName Channel;
+
+	/** Subsystem of the world this action was created in. Cached so that it can still leave the subsystem once
+	 * its owner is destroyed and the world can't be reached through it */
+	TWeakObjectPtr<UActionsSubsystem> CachedSubsystem;
+
 
 	/** If true the action will tick. Tick can be enabled or disabled while running. */
 	UPROPERTY(EditAnywhere, Category = Action)
@@ -121,6 +243,48 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = Action)
 	float TickRate = 0.15f;
 
+	/** How elapsed time is turned into ticks. Fixed step modes keep a constant simulation rate */
+	UPROPERTY(EditDefaultsOnly, Category = Action)
+	EActionTickMode TickMode = EActionTickMode::Variable;
+
+	/** If true Activate queues the action and the subsystem activates it in a later frame, within the activation
+	 * budget. Spreads bursts of activations over several frames. The action is Pending until then. */
+	UPROPERTY(EditDefaultsOnly, Category = Action)
+	bool bDeferredActivation = false;
+
+	/** If true the action is cancelled and notified when all actions are released in bulk, like on world
+	 * teardown. Otherwise it is released without running finish callbacks. */
+	UPROPERTY(EditDefaultsOnly, Category = Action)
+	bool bFinishOnRelease = false;
+
+	/** Actions with higher priority tick first and are the last deferred when over the tick budget */
+	UPROPERTY(EditDefaultsOnly, Category = Action)
+	EActionPriority Priority = EActionPriority::Normal;
+
+	/** If true the action keeps ticking while the game is paused. Useful for UI and menu actions */
+	UPROPERTY(EditDefaultsOnly, Category = Action)
+	bool bTickWhenPaused = false;
+
+	/** What happens when the owner creates this class while already running it */
+	UPROPERTY(EditDefaultsOnly, Category = Uniqueness)
+	EActionUniqueness Uniqueness = EActionUniqueness::None;
+
+	/** Seconds after an action of this class activates during which new ones of the same owner are ignored */
+	UPROPERTY(EditDefaultsOnly, Category = Uniqueness, meta = (ClampMin = "0", Units = "s"))
+	float DebounceTime = 0.f;
+
+	/** Tags describing this action. Running actions can be found or cancelled by them */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Action)
+	FGameplayTagContainer Tags;
+
+	/** Running actions of the same owner with any of these tags are cancelled when this action activates */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Action)
+	FGameplayTagContainer CancelTags;
+
+	/** This action can't activate while an action of the same owner with any of these tags is running */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Action)
+	FGameplayTagContainer BlockTags;
+
 
 public:
 	/** Delegates */
@@ -145,6 +309,15 @@ public:
 	/** Internal Use Only. Called when the action is stopped from running by its owner */
 	void Cancel();
 
+	/** Stops ticking this action and its children and pauses their timers, keeping their state.
+	 * Only timers started with SetTimer or SetTimerByEvent are paused. */
+	UFUNCTION(BlueprintCallable, Category = Action)
+	void Suspend();
+
+	/** Continues a suspended action. It stays suspended while its parent or owner are suspended */
+	UFUNCTION(BlueprintCallable, Category = Action)
+	void Resume();
+
 	/** Internal Use Only. Called by the subsystem when TickRate exceeds */
 	void DoTick(float DeltaTime)
 	{
@@ -167,9 +340,21 @@ protected:
 
 	virtual void Tick(float DeltaTime) {}
 
+	/** Called when a new action of this class was requested by the owner while running with RefreshExisting */
+	virtual void OnRefresh()
+	{
+		ReceiveRefresh();
+	}
+
 	virtual void OnFinish(const EActionState Reason);
 
 private:
+	/** Activates the action after its activation was requested and, if deferred, dequeued */
+	bool StartActivation(UActionsSubsystem* Subsystem);
+
+	/** @return true if this is a child of an action that is not running or is being torn down */
+	bool HasEndedParent() const;
+
 	void Finish(bool bSuccess = true);
 
 	void Destroy();
@@ -177,6 +362,11 @@ private:
 	void AddChildren(UAction* Child);
 	void RemoveChildren(UAction* Child);
 
+	void AddSuspension();
+	void RemoveSuspension();
+	void SetTimersPaused(bool bPaused);
+	void AddOwnedTimer(const FTimerHandle& Handle);
+
 
 public:
 	UFUNCTION(BlueprintCallable, Category = Action, meta = (KeyWords = "Finish"))
@@ -191,6 +381,25 @@ public:
 		Finish(false);
 	}
 
+	/** Constructs native state in the arena of this action tree. All state of the tree is freed at once when the
+	 * root action is torn down, so it must not be used after this action finishes.
+	 */
+	template <typename T, typename... ArgTypes>
+	T* AllocateState(ArgTypes&&... Args)
+	{
+		return GetArena().New<T>(Forward<ArgTypes>(Args)...);
+	}
+
+	/** @return the arena of the root action of this tree */
+	FActionArena& GetArena();
+
+	/** Starts a timer owned by this action. It is paused while the action is suspended. */
+	FTimerHandle SetTimer(FTimerDelegate Delegate, float Time, bool bLooping = false);
+
+	/** Starts a timer owned by this action. It is paused while the action is suspended. */
+	UFUNCTION(BlueprintCallable, Category = Action)
+	FTimerHandle SetTimerByEvent(FTimerDynamicDelegate Event, float Time, bool bLooping = false);
+
 
 	/** Events */
 protected:
@@ -206,6 +415,10 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, meta = (DisplayName = "Tick"))
 	void ReceiveTick(float DeltaTime);
 
+	/** Called when this action is requested again while running. Only if Uniqueness is RefreshExisting */
+	UFUNCTION(BlueprintImplementableEvent, meta = (DisplayName = "Refresh"))
+	void ReceiveRefresh();
+
 	/** Called when this action finishes */
 	UFUNCTION(BlueprintImplementableEvent, meta = (DisplayName = "Finished"))
 	void ReceiveFinished(const EActionState Reason);
@@ -214,9 +427,18 @@ protected:
 public:
 	bool CanTick() const
 	{
-		return bWantsToTick && IsRunning();
+		// Actions of owners dilated to 0 are frozen
+		return bWantsToTick && IsRunning() && !IsSuspended() && TimeDilation > 0.f;
 	}
 
+	/** @return the custom time dilation of the owner actor */
+	float GetTimeDilation() const
+	{
+		return TimeDilation;
+	}
+
+	/** Enables or disables ticking. Only running actions change tick groups. Others keep the value until they
+	 * activate, so it can be set before Activate */
 	UFUNCTION(BlueprintCallable, Category = Action)
 	void SetWantsToTick(bool bValue);
 
@@ -226,9 +448,72 @@ public:
 	UFUNCTION(BlueprintPure, Category = Action)
 	float GetTickRate() const;
 
+	/** Changes the tick length of this action in seconds. 0 ticks every frame.
+	 * If ticking, the action moves to the tick group of the new rate in O(1) and follows its tick period.
+	 */
+	UFUNCTION(BlueprintCallable, Category = Action)
+	void SetTickRate(float Value);
+
+	EActionTickMode GetTickMode() const
+	{
+		return TickMode;
+	}
+
+	EActionPriority GetPriority() const
+	{
+		return Priority;
+	}
+
+	bool GetFinishOnRelease() const
+	{
+		return bFinishOnRelease;
+	}
+
+	bool GetTickWhenPaused() const
+	{
+		return bTickWhenPaused;
+	}
+
+	const FGameplayTagContainer& GetTags() const
+	{
+		return Tags;
+	}
+
+	FName GetChannel() const
+	{
+		return Channel;
+	}
+
+	EActionUniqueness GetUniqueness() const
+	{
+		return Uniqueness;
+	}
+
+	float GetDebounceTime() const
+	{
+		return DebounceTime;
+	}
+
+	/** @return heap memory owned by this action, not including its children */
+	SIZE_T GetAllocatedSize() const;
+
+	/** @return true if the owner needs to track running actions of this class */
+	bool IsUniquenessTracked() const
+	{
+		return Uniqueness != EActionUniqueness::None || DebounceTime > 0.f;
+	}
+
 	UFUNCTION(BlueprintPure, Category = Action)
 	bool IsRunning() const;
 
+	/** @return true if waiting for a deferred activation */
+	UFUNCTION(BlueprintPure, Category = Action)
+	bool IsPending() const;
+
+	/** @return true if this action, its parent or its owner are suspended */
+	UFUNCTION(BlueprintPure, Category = Action)
+	bool IsSuspended() const;
+
 	UFUNCTION(BlueprintPure, Category = Action)
 	bool Succeeded() const;
 
@@ -264,6 +549,7 @@ public:
 
 	//~ Begin UObject Interface
 	void PostInitProperties() override;
+	void BeginDestroy() override;
 	//~ End UObject Interface
 
 protected:
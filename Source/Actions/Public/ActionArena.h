@@ -0,0 +1,74 @@
+// Copyright 2015-2026 Piperift. All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <type_traits>
+
+
+/**
+ * Bump allocator for the native state of an action tree.
+ * Allocations are contiguous and freed all at once, running destructors in reverse order.
+ * UObjects can't be allocated here.
+ */
+class ACTIONSEXTENSION_API FActionArena : public FNoncopyable
+{
+public:
+	/** Size of the first block. Next blocks double in size up to MaxBlockSize */
+	static constexpr SIZE_T MinBlockSize = 1024;
+	static constexpr SIZE_T MaxBlockSize = 64 * 1024;
+
+
+	FActionArena() = default;
+	~FActionArena()
+	{
+		Reset();
+	}
+
+	/** Constructs an object in the arena. It is destroyed when the arena is reset */
+	template <typename T, typename... ArgTypes>
+	T* New(ArgTypes&&... Args)
+	{
+		static_assert(!TIsDerivedFrom<T, UObject>::IsDerived, "UObjects can't be allocated in an arena.");
+
+		T* const Object = new (Allocate(sizeof(T), alignof(T))) T(Forward<ArgTypes>(Args)...);
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			Destructors.Add({Object, &DestroyObject<T>});
+		}
+		return Object;
+	}
+
+	/** @return uninitialized memory freed when the arena is reset */
+	void* Allocate(SIZE_T Size, SIZE_T Alignment);
+
+	/** Destroys all objects and frees all memory */
+	void Reset();
+
+	/** @return bytes reserved by the arena */
+	SIZE_T GetAllocatedSize() const
+	{
+		return AllocatedSize;
+	}
+
+private:
+	struct FDestructor
+	{
+		void* Object = nullptr;
+		void (*Destroy)(void*) = nullptr;
+	};
+
+	template <typename T>
+	static void DestroyObject(void* Object)
+	{
+		static_cast<T*>(Object)->~T();
+	}
+
+
+	TArray<void*, TInlineAllocator<2>> Blocks;
+	TArray<FDestructor> Destructors;
+	uint8* Cursor = nullptr;
+	uint8* End = nullptr;
+	SIZE_T NextBlockSize = MinBlockSize;
+	SIZE_T AllocatedSize = 0;
+};
@@ -10,6 +10,9 @@
 #include "ActionLibrary.generated.h"
 
 
+DECLARE_DYNAMIC_DELEGATE_OneParam(FActionCreatedDynamicDelegate, UAction*, Action);
+
+
 UCLASS()
 class ACTIONSEXTENSION_API UActionLibrary : public UBlueprintFunctionLibrary
 {
@@ -22,4 +25,17 @@ public:
 	{
 		return ::CreateAction(Owner, Class.Get(), bAutoActivate);
 	}
+
+	/** Creates an action once its class is loaded, streaming it if needed. */
+	UFUNCTION(BlueprintCallable, Category = Action,
+		meta = (DefaultToSelf = "Owner", WorldContext = "Owner", AutoCreateRefTerm = "OnCreated"))
+	static void CreateActionAsync(UObject* Owner, const TSoftClassPtr<UAction> Class,
+		const FActionCreatedDynamicDelegate& OnCreated, bool bAutoActivate = true);
+
+	/** Creates and activates an action in a channel of its owner, or queues it if the channel is full.
+	 * @return the action if it started immediately */
+	UFUNCTION(BlueprintCallable, Category = Action,
+		meta = (DefaultToSelf = "Owner", WorldContext = "Owner", AutoCreateRefTerm = "OnCreated"))
+	static UAction* CreateActionInChannel(UObject* Owner, const TSubclassOf<UAction> Class, FName Channel,
+		const FActionCreatedDynamicDelegate& OnCreated);
 };
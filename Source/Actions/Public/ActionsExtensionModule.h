@@ -3,6 +3,7 @@
 
 #include <Modules/ModuleInterface.h>
 #include <Modules/ModuleManager.h>
+#include <Stats/Stats.h>
 
 #if WITH_EDITOR
 #	include "Developer/AssetTools/Public/AssetToolsModule.h"
@@ -11,6 +12,7 @@
 #endif	  // WITH_EDITOR
 
 DECLARE_LOG_CATEGORY_EXTERN(LogActions, All, All);
+DECLARE_STATS_GROUP(TEXT("Actions"), STATGROUP_Actions, STATCAT_Advanced);
 
 
 class FActionsExtensionModule : public IModuleInterface
@@ -0,0 +1,199 @@
+// Copyright 2015-2026 Piperift. All Rights Reserved.
+
+#pragma once
+
+#include "ActionsSubsystem.h"
+
+#include <CoreMinimal.h>
+#include <Engine/DeveloperSettings.h>
+#include <Engine/World.h>
+
+#include "ActionsSettings.generated.h"
+
+
+class UAction;
+
+
+/**
+ * List of action classes
+ */
+USTRUCT()
+struct FActionClassList
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = Actions)
+	TArray<TSoftClassPtr<UAction>> Classes;
+};
+
+
+/**
+ * Tick rate reduction applied to actions whose owner has at least a significance
+ */
+USTRUCT()
+struct FActionSignificanceTier
+{
+	GENERATED_BODY()
+
+	/** Owners with this significance or more use this tier */
+	UPROPERTY(EditAnywhere, Category = Significance)
+	float MinSignificance = 0.f;
+
+	/** Multiplier applied to the TickRate of actions */
+	UPROPERTY(EditAnywhere, Category = Significance, meta = (ClampMin = "1"))
+	float TickRateScale = 1.f;
+
+	/** Minimum TickRate of actions in this tier. Also reduces actions ticking every frame */
+	UPROPERTY(EditAnywhere, Category = Significance, meta = (ClampMin = "0"))
+	float MinTickRate = 0.f;
+};
+
+
+/**
+ * Project settings of the actions extension
+ */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Actions"))
+class ACTIONSEXTENSION_API UActionsSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	/** Types of world where actions can run. The actions subsystem is not created for other worlds. */
+	UPROPERTY(Config, EditAnywhere, Category = Subsystem)
+	TArray<TEnumAsByte<EWorldType::Type>> SupportedWorldTypes;
+
+	/** Action classes streamed in as soon as a level's world is created, so that they are loaded before
+	 * gameplay creates them. They stay loaded while the world is alive. */
+	UPROPERTY(Config, EditAnywhere, Category = Loading)
+	TMap<TSoftObjectPtr<UWorld>, FActionClassList> PreloadedClasses;
+
+	/** Max number of steps fixed step actions can tick in a single frame to catch up with elapsed time.
+	 * Further steps are dropped, so a long frame doesn't cost an unbounded amount of ticks. */
+	UPROPERTY(Config, EditAnywhere, Category = Ticking, meta = (ClampMin = "1"))
+	int32 MaxTickCatchUpSteps = 4;
+
+	/** Milliseconds actions can spend ticking each frame. Once exceeded, remaining groups are deferred to
+	 * the next frame starting from the lowest priority, unless they reached their max tick delay.
+	 * 0 disables the budget. */
+	UPROPERTY(Config, EditAnywhere, Category = Ticking, meta = (ClampMin = "0", Units = "ms"))
+	float TickBudget = 0.f;
+
+	/** Seconds actions of each priority can tick late when over the tick budget. Missing priorities are
+	 * never deferred. */
+	UPROPERTY(Config, EditAnywhere, Category = Ticking, meta = (EditCondition = "TickBudget > 0"))
+	TMap<EActionPriority, float> MaxTickDelays;
+
+	/** Max number of actions with deferred activation activated in a single frame. 0 is unlimited. */
+	UPROPERTY(Config, EditAnywhere, Category = Activation, meta = (ClampMin = "0"))
+	int32 MaxActivationsPerFrame = 64;
+
+	/** Milliseconds per frame spent activating actions with deferred activation. At least one is activated
+	 * each frame. 0 is unlimited. */
+	UPROPERTY(Config, EditAnywhere, Category = Activation, meta = (ClampMin = "0", Units = "ms"))
+	float ActivationBudget = 0.f;
+
+	/** Max number of actions requested from other threads created in a single frame. Further requests wait for
+	 * the next frame. 0 is unlimited. */
+	UPROPERTY(Config, EditAnywhere, Category = Threading, meta = (ClampMin = "0"))
+	int32 MaxCreateRequestsPerFrame = 256;
+
+	/** Max number of actions requested from other threads waiting to be created. Requests beyond this are
+	 * rejected. 0 is unlimited. */
+	UPROPERTY(Config, EditAnywhere, Category = Threading, meta = (ClampMin = "0"))
+	int32 MaxPendingCreateRequests = 4096;
+
+	/** Max number of actions each owner can run at the same time in a channel. Further actions created in the
+	 * channel are queued. Channels not listed run one action at a time. */
+	UPROPERTY(Config, EditAnywhere, Category = Channels, meta = (ClampMin = "1"))
+	TMap<FName, int32> ChannelConcurrency;
+
+	/** If true, actions of a world being torn down are released in bulk without running finish callbacks,
+	 * except classes with bFinishOnRelease. If false, all of them are cancelled one by one. */
+	UPROPERTY(Config, EditAnywhere, Category = Subsystem)
+	bool bReleaseActionsOnWorldTeardown = false;
+
+	/** If true, actions of actors in levels that are loaded but not visible (like inactive world partition
+	 * cells) are suspended until their level becomes visible again. */
+	UPROPERTY(Config, EditAnywhere, Category = Ticking)
+	bool bDormantInHiddenLevels = false;
+
+	/** If true, actions tick less often while the frame time is over target, and recover once it drops.
+	 * Meant for dedicated servers. The Actions.Throttle console variable overrides it. */
+	UPROPERTY(Config, EditAnywhere, Category = Throttling)
+	bool bEnableThrottling = false;
+
+	/** Frame time throttling tries to keep. Only game thread work is measured, not time waiting for the next
+	 * frame. The Actions.Throttle.TargetFrameTime console variable overrides it. */
+	UPROPERTY(Config, EditAnywhere, Category = Throttling,
+		meta = (EditCondition = "bEnableThrottling", ClampMin = "1", Units = "ms"))
+	float ThrottleTargetFrameTime = 33.3f;
+
+	/** Seconds over which frame times are averaged. Higher values ignore shorter spikes */
+	UPROPERTY(Config, EditAnywhere, Category = Throttling,
+		meta = (EditCondition = "bEnableThrottling", ClampMin = "0", Units = "s"))
+	float ThrottleSmoothingTime = 1.f;
+
+	/** How fast the throttle scale changes per second, for each 100% of frame time over or under target */
+	UPROPERTY(Config, EditAnywhere, Category = Throttling,
+		meta = (EditCondition = "bEnableThrottling", ClampMin = "0"))
+	float ThrottleResponse = 1.f;
+
+	/** Max multiplier applied to the tick interval of actions of each priority. Missing priorities and actions
+	 * ticking when paused are never throttled. */
+	UPROPERTY(Config, EditAnywhere, Category = Throttling, meta = (EditCondition = "bEnableThrottling"))
+	TMap<EActionPriority, float> MaxThrottleScales;
+
+	/** If true, actions tick slower the less significant their owner is */
+	UPROPERTY(Config, EditAnywhere, Category = Significance)
+	bool bEnableSignificance = false;
+
+	/** Seconds between significance updates of all owners */
+	UPROPERTY(Config, EditAnywhere, Category = Significance,
+		meta = (EditCondition = "bEnableSignificance", ClampMin = "0"))
+	float SignificanceUpdateInterval = 0.5f;
+
+	/** Tiers ordered from most to least significant. Owners below the last tier use the last tier.
+	 * Owners without a significance always tick at full rate. */
+	UPROPERTY(Config, EditAnywhere, Category = Significance, meta = (EditCondition = "bEnableSignificance"))
+	TArray<FActionSignificanceTier> SignificanceTiers;
+
+
+	UActionsSettings();
+
+	/** @return the action classes to preload for a world, if any */
+	const FActionClassList* FindPreloadedClasses(const UWorld* World) const;
+
+	/** @return seconds actions of a priority can tick late when over the tick budget */
+	float GetMaxTickDelay(EActionPriority Priority) const
+	{
+		const float* Delay = MaxTickDelays.Find(Priority);
+		return Delay ? *Delay : 0.f;
+	}
+
+	/** @return max multiplier of the tick interval of actions of a priority. 1 if not throttled */
+	float GetMaxThrottleScale(EActionPriority Priority) const
+	{
+		const float* Scale = MaxThrottleScales.Find(Priority);
+		return Scale ? FMath::Max(1.f, *Scale) : 1.f;
+	}
+
+	/** @return max multiplier of the tick interval of any priority */
+	float GetMaxThrottleScale() const;
+
+	/** @return max running actions per owner in a channel */
+	int32 GetChannelConcurrency(FName Channel) const
+	{
+		const int32* Concurrency = ChannelConcurrency.Find(Channel);
+		return Concurrency ? FMath::Max(1, *Concurrency) : 1;
+	}
+
+	/** @return the index of the significance tier of a significance */
+	int32 FindSignificanceTier(float Significance) const;
+
+	//~ Begin UDeveloperSettings Interface
+	FName GetCategoryName() const override
+	{
+		return TEXT("Plugins");
+	}
+	//~ End UDeveloperSettings Interface
+};
@@ -2,18 +2,56 @@
 
 #pragma once
 
+#include <Containers/Queue.h>
+#include <Containers/RingBuffer.h>
+#include <Containers/Ticker.h>
 #include <CoreMinimal.h>
+#include <Engine/StreamableManager.h>
 #include <Engine/World.h>
+#include <GameplayTagContainer.h>
 #include <Subsystems/WorldSubsystem.h>
 #include <Tickable.h>
+#include <atomic>
 
 #include "ActionsSubsystem.generated.h"
 
 
 class UAction;
 
+DECLARE_DELEGATE_OneParam(FActionCreatedDelegate, UAction* /* Action */);
+
+/** Returns the significance of an action owner, or a negative value if it has none */
+DECLARE_DELEGATE_RetVal_OneParam(float, FActionSignificanceDelegate, const UObject* /* Owner */);
+
+/**
+ * How elapsed time is converted into ticks of an action with a TickRate
+ */
+UENUM()
+enum class EActionTickMode : uint8
+{
+	/** Ticks once TickRate has elapsed, with all the time elapsed. The remainder is discarded */
+	Variable,
+	/** Ticks with a whole number of TickRate steps. The remainder is kept for the next tick */
+	FixedStep,
+	/** Like FixedStep, but ticks once per step, each with TickRate as delta */
+	FixedSubStep
+};
+
+/**
+ * Order in which actions tick. When the frame tick budget is exceeded, lower priorities are deferred first
+ */
+UENUM()
+enum class EActionPriority : uint8
+{
+	Critical,
+	High,
+	Normal,
+	Low
+};
+
+
 /**
- * Contains a list of actions with the same TickRate
+ * Contains a list of actions with the same TickRate, TickMode and Priority
  */
 USTRUCT()
 struct FActionsTickGroup
@@ -23,24 +61,74 @@ struct FActionsTickGroup
 	UPROPERTY()
 	float TickRate = 0.f;
 
+	UPROPERTY()
+	EActionTickMode TickMode = EActionTickMode::Variable;
+
+	UPROPERTY()
+	EActionPriority Priority = EActionPriority::Normal;
+
+	/** Max number of fixed steps ticked in one frame. Steps beyond this are dropped */
+	UPROPERTY()
+	int32 MaxCatchUpSteps = 1;
+
+	/** Seconds this group can tick late while the frame tick budget is exceeded */
+	UPROPERTY()
+	float MaxTickDelay = 0.f;
+
+	/** Seconds between ticks. TickRate, lengthened while actions are throttled */
+	UPROPERTY(Transient)
+	float Interval = 0.f;
+
 	UPROPERTY(Transient)
 	float TickTimeElapsed = 0.f;
 
-	UPROPERTY()
+	/** Not visited by GC. Running actions are kept alive by the subsystem's live actions.
+	 * Each action keeps its index here in TickGroupSlot. */
 	TArray<UAction*> Actions;
 
 
-	FActionsTickGroup(float TickRate = 0.f) : TickRate(TickRate) {}
+	FActionsTickGroup(float TickRate = 0.f, EActionTickMode TickMode = EActionTickMode::Variable,
+		EActionPriority Priority = EActionPriority::Normal)
+		: TickRate(TickRate)
+		, TickMode(TickMode)
+		, Priority(Priority)
+		, Interval(TickRate)
+	{}
 
 	inline void Tick(float DeltaTime);
 
+	/** Accumulates elapsed time without ticking */
+	void AddTime(float DeltaTime)
+	{
+		if (Actions.Num() > 0)
+		{
+			TickTimeElapsed += DeltaTime;
+		}
+	}
+
+	/** @return true if enough time elapsed for actions to tick */
+	bool IsDue() const
+	{
+		return Actions.Num() > 0 && (Interval <= KINDA_SMALL_NUMBER || TickTimeElapsed >= Interval);
+	}
+
+	/** @return seconds left until this group has to tick even if over budget. Its soft deadline */
+	float GetSlack() const
+	{
+		return Interval + MaxTickDelay - TickTimeElapsed;
+	}
+
+	/** Ticks actions with the time accumulated. Should only be called if due */
+	inline void TickElapsed();
+
 private:
 	inline void DelayedTick(float DeltaTime);
 
 public:
 	bool operator==(const FActionsTickGroup& Other) const
 	{
-		return FMath::IsNearlyEqual(TickRate, Other.TickRate);
+		return FMath::IsNearlyEqual(TickRate, Other.TickRate) && TickMode == Other.TickMode &&
+			   Priority == Other.Priority;
 	}
 	bool operator!=(const FActionsTickGroup& Other) const
 	{
@@ -49,10 +137,98 @@ public:
 
 	friend const uint32 GetTypeHash(const FActionsTickGroup& InGroup)
 	{
-		return GetTypeHash(InGroup.TickRate);
+		return HashCombine(HashCombine(GetTypeHash(InGroup.TickRate), GetTypeHash(InGroup.TickMode)),
+			GetTypeHash(InGroup.Priority));
 	}
 };
 
+/**
+ * Change to the tick groups requested while they were being ticked
+ */
+struct FActionsTickCommand
+{
+	UAction* Action = nullptr;
+	bool bAdd = true;
+};
+
+/**
+ * An action waiting in a channel for a free slot. It is not created until then
+ */
+struct FQueuedAction
+{
+	TObjectPtr<UClass> Class;
+	TObjectPtr<UAction> Template;
+	FActionCreatedDelegate OnCreated;
+};
+
+/**
+ * Limits how many actions of an owner run at the same time. Extra actions wait in a FIFO queue
+ */
+struct FActionChannel
+{
+	int32 MaxConcurrency = 1;
+	int32 NumRunning = 0;
+
+	/** True if MaxConcurrency was set for this owner instead of coming from settings */
+	bool bCustomConcurrency = false;
+
+	/** True while queued actions are being started */
+	bool bDequeuing = false;
+
+	TRingBuffer<FQueuedAction> Queue;
+
+	/** @return true if this channel has state worth keeping */
+	bool IsActive() const
+	{
+		return NumRunning > 0 || !Queue.IsEmpty() || bCustomConcurrency;
+	}
+};
+
+/**
+ * When the uniqueness policy of an action is applied. Running actions are only refreshed or replaced by actions
+ * that activate
+ */
+enum class EActionUniquenessCheck : uint8
+{
+	/** Created without activating. Only ignored duplicates are rejected */
+	Create,
+	/** Created and activated right away. Refreshing is resolved before allocating the action */
+	CreateAndActivate,
+	Activate
+};
+
+/**
+ * Last action of a class activated by an owner, for classes with a uniqueness policy or debounce
+ */
+struct FActionClassSlot
+{
+	/** Running action. Null once it ended */
+	UAction* Action = nullptr;
+
+	/** World time until which new actions of this class are ignored */
+	double DebounceEndTime = 0.0;
+};
+
+/**
+ * Class data used to index actions, resolved once per class from its default object instead of on each
+ * activation and teardown.
+ * Action configuration is not part of it. It stays on each instance, where class defaults and templates set it.
+ */
+struct FActionClassDescriptor
+{
+	/** The class and its parents up to UAction. Actions are indexed by all of them */
+	TArray<const UClass*, TInlineAllocator<4>> ClassChain;
+
+	/** Tags of the class */
+	FGameplayTagContainer Tags;
+	/** Tags and all their parents. Actions with the class tags index and count these */
+	FGameplayTagContainer TagsWithParents;
+
+
+	/** @return bytes used by this descriptor, including its containers */
+	SIZE_T GetAllocatedSize() const;
+};
+
 /**
  * Represents a dependency of an objects with all its actions
  * Used to cancel actions whose owner is destroyed
@@ -62,11 +238,38 @@ struct FActionOwner
 {
 	GENERATED_BODY()
 
+	/** Number of root actions stored inline before the owner allocates */
+	static constexpr int32 NumInlineActions = 4;
+
 	UPROPERTY()
 	TWeakObjectPtr<UObject> Owner;
 
-	UPROPERTY()
-	TArray<TObjectPtr<UAction>> Actions;
+	// Most owners run very few actions, so they are kept inline. Kept alive by the subsystem's live actions
+	TArray<TObjectPtr<UAction>, TInlineAllocator<NumInlineActions>> Actions;
+
+	/** Number of running actions (roots and children) with each tag or a child of it */
+	TMap<FGameplayTag, int32> TagCounts;
+
+	/** Running unique actions and debounce windows by class. Only classes with a uniqueness policy */
+	TMap<const UClass*, FActionClassSlot> ClassSlots;
+
+	/** Concurrency channels of this owner. Classes and templates referenced in AddStructReferencedObjects */
+	TMap<FName, FActionChannel> Channels;
+
+	/** Significance tier reducing the tick rate of this owner's actions. None ticks at full rate */
+	int32 SignificanceTier = INDEX_NONE;
+
+	/** Custom time dilation of the owner actor */
+	float TimeDilation = 1.f;
+
+	/** If true all actions of this owner are suspended */
+	bool bSuspended = false;
+
+	/** If true all actions of this owner are suspended because it is in an inactive region of the world */
+	bool bDormant = false;
+
+	/** If true all actions of this owner are suspended because its level is hidden */
+	bool bLevelDormant = false;
 
 
 	FActionOwner(UObject* Owner = nullptr) : Owner(Owner) {}
@@ -74,6 +277,32 @@ struct FActionOwner
 	void CancelAll(bool bShouldShrink = true);
 	void CancelByPredicate(const TFunctionRef<bool(const UAction*)>& Predicate, bool bShouldShrink = true);
 
+	/** Drops all queued actions. Their OnCreated is called with nullptr */
+	void ClearChannelQueues();
+	bool HasActiveChannels() const;
+
+	/** Removes class slots without running action whose debounce ended */
+	void PruneClassSlots(double Time);
+
+	/** Counts tags of an action. They must already include their parents */
+	void AddTags(const FGameplayTagContainer& TagsWithParents);
+	void RemoveTags(const FGameplayTagContainer& TagsWithParents);
+
+	/** @return true if any running action of this owner has any of these tags. O(Tags) */
+	bool HasAnyTags(const FGameplayTagContainer& Tags) const;
+
+	bool IsDormant() const
+	{
+		return bDormant || bLevelDormant;
+	}
+
+	bool IsSuspended() const
+	{
+		return bSuspended || IsDormant();
+	}
+
+	void AddStructReferencedObjects(FReferenceCollector& Collector);
+
 	/**
 	 * Operator overloading & Hashes
 	 */
@@ -91,6 +320,79 @@ struct FActionOwner
 	}
 };
 
+template <>
+struct TStructOpsTypeTraits<FActionOwner> : public TStructOpsTypeTraitsBase2<FActionOwner>
+{
+	enum
+	{
+		WithAddStructReferencedObjects = true,
+	};
+};
+
+
+/**
+ * Filters running actions. Empty fields match any action.
+ */
+USTRUCT(BlueprintType)
+struct FActionQuery
+{
+	GENERATED_BODY()
+
+	/** Actions must be of this class or a child of it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Query)
+	TSubclassOf<UAction> Class;
+
+	/** Actions must be run by this owner */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Query)
+	TObjectPtr<UObject> Owner;
+
+	/** Actions must have all these tags */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Query)
+	FGameplayTagContainer RequiredTags;
+
+	/** Actions must have at least one of these tags */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Query)
+	FGameplayTagContainer AnyTags;
+
+	/** If true actions waiting for a deferred activation match too */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Query)
+	bool bIncludePending = false;
+
+
+	bool Matches(const UAction* Action) const;
+};
+
+
+/**
+ * An action waiting for its class to be streamed before being created
+ */
+struct FPendingAsyncAction
+{
+	TWeakObjectPtr<UObject> Owner;
+	bool bAutoActivate = true;
+	FActionCreatedDelegate OnCreated;
+};
+
+/**
+ * Request to create an action made from any thread. Resolved on the game thread
+ */
+struct FActionCreateRequest
+{
+	TWeakObjectPtr<UObject> Owner;
+	TWeakObjectPtr<UClass> Class;
+	TFunction<void(UAction*)> OnCreated;
+	bool bAutoActivate = true;
+};
+
+/**
+ * Streaming of an action class. All actions requested while loading share it
+ */
+struct FActionClassLoadRequest
+{
+	TSharedPtr<FStreamableHandle> Handle;
+	TArray<FPendingAsyncAction> PendingActions;
+};
+
 
 /**
  * Actions Subsystem
@@ -108,9 +410,81 @@ private:
 	UPROPERTY(SaveGame)
 	TSet<FActionOwner> ActionOwners;
 
+	/** Running actions indexed by their class and all its parent classes up to UAction */
+	TMap<const UClass*, TSet<UAction*>> ActionsByClass;
+
+	/** Running actions indexed by each of their tags and the parents of those tags */
+	TMap<FGameplayTag, TSet<UAction*>> ActionsByTag;
+
+	/** Index data of each action class activated in this world */
+	TMap<TObjectKey<UClass>, TUniquePtr<FActionClassDescriptor>> ClassDescriptors;
+
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+
+	/** Every running action, referenced for GC in a single pass by AddReferencedObjects.
+	 * Owners, tick groups and indices don't reference actions. */
+	TArray<TObjectPtr<UAction>> LiveActions;
+
+	/** Owner of the last root action added. Avoids hashing when adding several actions to the same owner */
+	FSetElementId LastOwnerId;
+
 	UPROPERTY(Transient)
 	TArray<FActionsTickGroup> TickGroups;
 
+	/** Tick groups of actions that tick when the game is paused. Only these are visited while paused */
+	UPROPERTY(Transient)
+	TArray<FActionsTickGroup> PausedTickGroups;
+
+	/** True while tick groups are ticking. Tick groups can't be modified then */
+	bool bTickingGroups = false;
+
+	/** Changes to tick groups deferred until all groups have ticked */
+	TArray<FActionsTickCommand> TickCommands;
+
+	/** Time since owner significances were last updated */
+	float SignificanceTimeElapsed = 0.f;
+
+	/** Game thread time per frame, without idle time, averaged over the throttle smoothing time */
+	float SmoothedFrameTime = 0.f;
+
+	/** World delta time averaged like SmoothedFrameTime. Interval of throttled groups ticking every frame */
+	float SmoothedDeltaTime = 0.f;
+
+	/** Multiplier of the tick intervals of throttled priorities. 1 while under the target frame time */
+	float ThrottleScale = 1.f;
+
+	/** Overrides how owner significance is obtained. Uses the significance manager if unbound */
+	FActionSignificanceDelegate SignificanceDelegate;
+
+	/** Action classes being streamed by CreateActionAsync */
+	TMap<FSoftObjectPath, FActionClassLoadRequest> ClassLoadRequests;
+
+	/** Keeps preloaded action classes of this world's level in memory */
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+
+	/** Destroyed actions waiting to be removed from all arrays and marked as garbage */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAction>> Teardowns;
+
+	/** Processes teardowns on the next engine frame in worlds where this subsystem doesn't tick, like editor worlds */
+	FTSTicker::FDelegateHandle TeardownTickerHandle;
+
+	/** Actions waiting for a deferred activation, in activation order. Cancelled ones are skipped */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAction>> PendingActivations;
+
+	/** First unprocessed entry of PendingActivations. Processed ones are compacted away in batches */
+	int32 PendingActivationsHead = 0;
+
+	/** Actions requested from any thread, created at the start of the next tick */
+	TQueue<FActionCreateRequest, EQueueMode::Mpsc> CreateRequests;
+
+	std::atomic<int32> NumPendingCreateRequests = 0;
+
+	/** Copied from settings so that other threads don't read them */
+	int32 MaxPendingCreateRequests = 0;
+
 
 protected:
 	void Initialize(FSubsystemCollectionBase& Collection) override;
@@ -119,29 +493,242 @@ protected:
 
 public:
 	void Tick(float DeltaTime) override;
+	bool IsTickable() const override;
+	bool IsTickableWhenPaused() const override;
 
 	TStatId GetStatId() const override;
 
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
 
 	/** Cancel all current actions of the game. Use with care! */
 	void CancelAll();
 
+	/** Destroys all actions at once without running their finish callbacks. Much faster than CancelAll.
+	 * Actions with bFinishOnRelease are cancelled normally first.
+	 */
+	void ReleaseAll();
+
 	/** Cancel all actions executing inside an object
 	 * @param Owner of the actions to cancel
 	 */
 	UFUNCTION(BlueprintCallable, Category = ActionSubsystem)
 	void CancelAllByOwner(UObject* Object);
 
+	/** Suspends all actions of an owner, including actions activated while it is suspended.
+	 * Suspension ends when the owner runs out of actions. Owners without actions are ignored.
+	 * @param Owner of the actions to suspend
+	 */
+	UFUNCTION(BlueprintCallable, Category = ActionSubsystem)
+	void SuspendAllByOwner(UObject* Object);
+
+	/** Resumes all actions of an owner suspended with SuspendAllByOwner
+	 * @param Owner of the actions to resume
+	 */
+	UFUNCTION(BlueprintCallable, Category = ActionSubsystem)
+	void ResumeAllByOwner(UObject* Object);
+
+	UFUNCTION(BlueprintPure, Category = ActionSubsystem)
+	bool IsOwnerSuspended(UObject* Object) const;
+
+	/** Makes all actions of an owner dormant or wakes them up. Dormant actions are suspended.
+	 * Owners in hidden levels are made dormant automatically. This can be used for other inactive regions,
+	 * and is kept when their level becomes visible. Owners without actions are ignored.
+	 * @param Owner of the actions
+	 */
+	UFUNCTION(BlueprintCallable, Category = ActionSubsystem)
+	void SetOwnerDormant(UObject* Object, bool bDormant);
+
 	/** Cancel all actions matching a predicate */
 	void CancelByPredicate(TFunctionRef<bool(const UAction*)> Predicate);
 
 	/** Cancel all actions with matching owner and predicate */
 	void CancelByOwnerPredicate(UObject* Object, TFunctionRef<bool(const UAction*)> Predicate);
 
+	/** Finds all running actions matching a query
+	 * @param Query to filter actions with
+	 * @param OutActions found actions are added here
+	 */
+	UFUNCTION(BlueprintCallable, Category = ActionSubsystem)
+	void FindActions(const FActionQuery& Query, TArray<UAction*>& OutActions) const;
+
+	/** @return the number of running actions matching a query */
+	UFUNCTION(BlueprintPure, Category = ActionSubsystem)
+	int32 CountActions(const FActionQuery& Query) const;
+
+	/** Cancel all running actions matching a query
+	 * @return the number of actions cancelled
+	 */
+	UFUNCTION(BlueprintCallable, Category = ActionSubsystem)
+	int32 CancelActions(const FActionQuery& Query);
+
+	/** @return true if any running action of an owner has any of these tags
+	 * @param Owner of the actions
+	 * @param Tags to check. Actions with a child tag also match.
+	 */
+	UFUNCTION(BlueprintPure, Category = ActionSubsystem)
+	bool HasActionsWithTags(UObject* Owner, const FGameplayTagContainer& Tags) const;
+
+	/** Cancel all running actions of an owner with any of these tags
+	 * @return the number of actions cancelled
+	 */
+	UFUNCTION(BlueprintCallable, Category = ActionSubsystem)
+	int32 CancelActionsWithTags(UObject* Owner, const FGameplayTagContainer& Tags);
+
+	/** Requests an action to be created. Thread safe, can be called from any thread.
+	 * Actions are created on the game thread at the start of the next tick, in request order. Get the subsystem
+	 * on the game thread and keep it alive while requesting from others.
+	 * @param Owner of the action. If destroyed before the request is processed, no action is created.
+	 * @param Class of the action to create
+	 * @param OnCreated called on the game thread with the new action before it activates, or with nullptr if it
+	 * could not be created.
+	 * @param bAutoActivate if true activates the action after OnCreated.
+	 * @return false if too many requests are pending. The request is dropped.
+	 */
+	bool RequestCreateAction(TWeakObjectPtr<UObject> Owner, TSubclassOf<UAction> Class,
+		TFunction<void(UAction*)> OnCreated = {}, bool bAutoActivate = true);
+
+	/** Reserves space for many actions about to be created from the same class or template
+	 * @param Defaults template or default object of the actions
+	 * @param Num number of actions, each of a different owner
+	 * @param bActivated if the actions will be activated, reserves their indices and tick group too
+	 */
+	void ReserveActions(const UAction* Defaults, int32 Num, bool bActivated);
+
+	/** Applies the uniqueness policy and debounce of an action about to be created or activated by an owner.
+	 * Can cancel or refresh the running action of the same class.
+	 * @param Action being activated, or the template or default object of the action to create
+	 * @param OutExisting the refreshed action, if any
+	 * @return false if the action must not be created or activated
+	 */
+	bool ApplyUniqueness(
+		UObject* Owner, const UAction* Action, EActionUniquenessCheck Check, UAction*& OutExisting);
+
+	/** Creates and activates an action in a channel of its owner, or queues it if the channel is full.
+	 * @see CreateActionInChannel
+	 */
+	UAction* CreateActionInChannel(UObject* Owner, UClass* Class, const UAction* Template, FName Channel,
+		FActionCreatedDelegate OnCreated);
+
+	/** Sets how many actions of an owner can run at the same time in a channel. Overrides project settings.
+	 * Queued actions start if slots became free. Running actions are never cancelled.
+	 */
+	UFUNCTION(BlueprintCallable, Category = ActionSubsystem)
+	void SetChannelConcurrency(UObject* Object, FName Channel, int32 MaxConcurrency);
+
+	/** @return the number of actions waiting for a slot in a channel of an owner */
+	UFUNCTION(BlueprintPure, Category = ActionSubsystem)
+	int32 GetNumQueuedActions(UObject* Object, FName Channel) const;
+
+	/** @return the running action of a class with a uniqueness policy, like one refreshed by CreateAction */
+	UFUNCTION(BlueprintPure, Category = ActionSubsystem)
+	UAction* GetUniqueAction(UObject* Object, TSubclassOf<UAction> Class) const;
+
+	/** @return index data shared by all actions of a class. Built from its default object on first use */
+	const FActionClassDescriptor& GetClassDescriptor(const UClass* Class);
+
+	/** Logs memory used by running actions of each class and by the index data of their classes */
+	void DumpMemoryReport(FOutputDevice& Ar) const;
+
+	/** @return the multiplier currently applied to tick intervals of throttled priorities. 1 if not throttling */
+	UFUNCTION(BlueprintPure, Category = ActionSubsystem)
+	float GetThrottleScale() const
+	{
+		return ThrottleScale;
+	}
+
+	/** @return seconds between ticks of an action, after significance and throttling. Negative if not ticking */
+	float GetTickInterval(const UAction* Action) const;
+
+	/** Replaces the significance manager as the source of owner significance for tick rate reduction.
+	 * Required for significance when the SignificanceManager plugin is disabled. */
+	void SetSignificanceProvider(FActionSignificanceDelegate Provider);
+
+	/** Streams an action class and creates the pending action once loaded.
+	 * Requests of a class already being loaded are added to the same load.
+	 */
+	void RequestActionClass(const TSoftClassPtr<UAction>& Class, FPendingAsyncAction&& PendingAction);
+
 private:
+	/** Creates actions requested from other threads, up to the per frame limit */
+	void ProcessCreateRequests();
+
+	void AddPendingActivation(UAction* Action);
+	/** Activates pending actions, up to the per frame limit and budget */
+	void ProcessPendingActivations();
+	void CancelPendingActivations(const UObject* Owner);
+
+	void OnActionClassLoaded(FSoftObjectPath ClassPath);
+	void PreloadActionClasses();
+
+	/** Cancels actions of destroyed owners and removes owners without actions */
+	void SweepOwners();
+
+	FSetElementId FindOrAddOwner(UObject* Owner);
+
+	FActionChannel& FindOrAddChannel(FActionOwner& Owner, FName Channel);
+	FActionChannel* FindChannel(UObject* Owner, FName Channel);
+	UAction* StartChannelAction(
+		UObject* Owner, FName Channel, UClass* Class, const UAction* Template, FActionCreatedDelegate& OnCreated);
+	/** Called when an action created in a channel ends. Starts queued actions of the channel */
+	void ReleaseChannelSlot(UAction* Action);
+	void DequeueChannelActions(UObject* Owner, FName Channel);
+	/** Reads the custom time dilation of an owner actor and applies it to its actions if it changed */
+	void UpdateOwnerTimeDilation(FActionOwner& Owner);
+	void OnLevelVisibilityChanged(ULevel* Level, UWorld* World, bool bVisible);
+	/** Counts dormant owners and actions every frame while stats are collected */
+	void UpdateDormancyStats();
+	/** Applies a change of an owner's suspension to its actions */
+	void OnOwnerSuspensionChanged(FActionOwner& Owner, bool bWasSuspended);
+
 	void AddRootAction(UAction* Child);
+	/** Frees the uniqueness slot a root action holds in its owner */
+	void ReleaseClassSlot(UAction* Child);
+
+	void AddTeardown(UAction* Action);
+	/** Removes destroyed actions from owners, parents and tick groups, compacting each array once */
+	void ProcessTeardowns();
+	/** @return the owner entry of an action's root, if it has been added */
+	FActionOwner* FindOwnerSlot(const UAction* Action);
+	/** Cancels all actions of an owner already removed from ActionOwners */
+	void CancelRemovedOwner(FActionOwner& Owner);
+
+	void AddLiveAction(UAction* Action);
+	/** Removes an action from the live actions in O(1), swapping the last one into its place */
+	void RemoveLiveAction(UAction* Action);
+
+	void AddActionToIndices(UAction* Action);
+	void RemoveActionFromIndices(UAction* Action);
+
+	/** Calls Callback for every running action matching Query, iterating the smallest index possible.
+	 * Callback returns false to stop iterating.
+	 */
+	void ForEachMatchingAction(const FActionQuery& Query, TFunctionRef<bool(UAction*)> Callback) const;
 	void AddActionToTickGroup(UAction* Child);
 	void RemoveActionFromTickGroup(UAction* Child);
+	/** Moves a ticking action to the tick group matching its current tick rate */
+	void RescheduleAction(UAction* Action);
+	/** Removes tick groups without actions, updating the group index of actions in moved groups */
+	void RemoveEmptyTickGroups(TArray<FActionsTickGroup>& Lane);
+	FActionsTickGroup& FindOrAddTickGroup(TArray<FActionsTickGroup>& Lane, const FActionsTickGroup& Key);
+	void ApplyTickCommands();
+	/** Ticks due groups by priority and earliest deadline, deferring the rest once over budget */
+	void TickGroupsInBudget(float DeltaTime, float PausedLaneDeltaTime, bool bPaused, float Budget);
+
+	TArray<FActionsTickGroup>& GetTickLane(const UAction* Action);
+
+	/** @return the TickRate of an action after its owner's significance is applied */
+	float GetScheduledTickRate(const UAction* Action);
+
+	/** Adjusts the throttle scale from recent frame times and applies it to tick groups */
+	void UpdateThrottle(float DeltaTime);
+	/** Sets the tick interval of a group from its tick rate and the throttle scale */
+	void ApplyThrottle(FActionsTickGroup& Group) const;
+
+	void UpdateSignificance(float DeltaTime);
+	float GetOwnerSignificance(const UObject* Owner) const;
+	/** Moves all ticking actions of an owner to the tick groups of their current tick rate */
+	void RescheduleOwner(const FActionOwner& Owner);
 
 public:
 #if WITH_GAMEPLAY_DEBUGGER
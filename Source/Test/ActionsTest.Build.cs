@@ -22,7 +22,8 @@ namespace UnrealBuildTool.Rules
 				"ActionsExtension",
 				"CoreUObject",
 				"Engine",
-				"EngineSettings"
+				"EngineSettings",
+				"GameplayTags"
 			});
 
 			if (Target.bBuildEditor)
@@ -0,0 +1,92 @@
+// Copyright 2015-2026 Piperift. All Rights Reserved.
+
+#include "Automatron.h"
+#include "TestAction.h"
+
+#include <GameFramework/Actor.h>
+
+
+/**
+ * Timings logged to compare versions. Only run with the performance filter, since they check no behavior
+ */
+class FActionsPerf : public Automatron::FTestSpec
+{
+	GENERATE_SPEC(FActionsPerf, "ActionsExtension.Perf",
+		EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask);
+
+	FActionsPerf()
+	{
+		bCanUsePIEWorld = true;
+	}
+};
+
+void FActionsPerf::Define()
+{
+	Describe("Batch creation", [this]() {
+		It("Compares creating actions in a batch and in a loop", [this]() {
+			constexpr int32 NumOwners = 512;
+			constexpr int32 NumRounds = 4;
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			TArray<UObject*> Owners;
+			for (int32 i = 0; i < NumOwners; ++i)
+			{
+				Owners.Add(GetWorld()->SpawnActor<AActor>());
+			}
+
+			// Rounds alternate which version goes first, so that neither always runs on warm caches
+			double LoopTime = 0.0;
+			double BatchTime = 0.0;
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+			{
+				for (int32 Version = 0; Version < 2; ++Version)
+				{
+					const bool bBatch = (Round + Version) % 2 == 0;
+					const double StartTime = FPlatformTime::Seconds();
+					if (bBatch)
+					{
+						CreateActions(Owners, UTestAction::StaticClass(), true);
+					}
+					else
+					{
+						for (UObject* Owner : Owners)
+						{
+							CreateAction(Owner, UTestAction::StaticClass(), true);
+						}
+					}
+					(bBatch ? BatchTime : LoopTime) += FPlatformTime::Seconds() - StartTime;
+
+					for (UObject* Owner : Owners)
+					{
+						Subsystem->CancelAllByOwner(Owner);
+					}
+				}
+			}
+			AddInfo(FString::Printf(TEXT("%d owners. Loop: %.3fms Batch: %.3fms"), NumOwners,
+				LoopTime * 1000.0 / NumRounds, BatchTime * 1000.0 / NumRounds));
+
+			for (UObject* Owner : Owners)
+			{
+				CastChecked<AActor>(Owner)->Destroy();
+			}
+		});
+	});
+
+	Describe("Garbage collection", [this]() {
+		It("Measures collection with many running actions", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			for (const int32 NumActions : {10000, 100000})
+			{
+				for (int32 i = 0; i < NumActions; ++i)
+				{
+					CreateAction<UTestAction>(GetWorld(), true);
+				}
+
+				const double StartTime = FPlatformTime::Seconds();
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+				const double GCTime = FPlatformTime::Seconds() - StartTime;
+				AddInfo(FString::Printf(TEXT("%d actions. GC: %.3fms"), NumActions, GCTime * 1000.0));
+				Subsystem->CancelAllByOwner(GetWorld());
+			}
+		});
+	});
+}
@@ -1,8 +1,16 @@
 // Copyright 2015-2026 Piperift. All Rights Reserved.
 
+#include "ActionsSettings.h"
 #include "Automatron.h"
 #include "TestAction.h"
 
+#include <GameFramework/Actor.h>
+#include <HAL/IConsoleManager.h>
+#include <NativeGameplayTags.h>
+
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_ActionsTest, "ActionsTest");
+
 
 class FActionsSpec : public Automatron::FTestSpec
 {
@@ -37,5 +45,360 @@ void FActionsSpec::Define()
 				TestTrue("Activated", Action->IsRunning());
 			}
 		});
+
+		It("Can't activate children of a finished parent", [this]() {
+			UTestAction* Parent = CreateAction<UTestAction>(GetWorld(), true);
+			Parent->Succeed();
+
+			// The parent is still valid until teardown
+			UTestAction* Child = CreateAction<UTestAction>(Parent);
+			TestFalse("Activated", Child->Activate());
+			TestFalse("Running", Child->IsRunning());
+		});
+	});
+
+	Describe("Tags", [this]() {
+		It("Can't activate a child that cancels its own parent", [this]() {
+			UTestTaggedAction* Parent = CreateAction<UTestTaggedAction>(GetWorld());
+			Parent->SetTags(FGameplayTagContainer(TAG_ActionsTest), {});
+			TestTrue("Parent activated", Parent->Activate());
+
+			UTestTaggedAction* Child = CreateAction<UTestTaggedAction>(Parent);
+			Child->SetTags({}, FGameplayTagContainer(TAG_ActionsTest));
+			TestFalse("Child activated", Child->Activate());
+			TestFalse("Child running", Child->IsRunning());
+			TestTrue("Parent cancelled", Parent->GetState() == EActionState::Cancelled);
+		});
+	});
+
+	Describe("Uniqueness", [this]() {
+		It("Replaces the running action once the new one activates", [this]() {
+			AActor* Owner = GetWorld()->SpawnActor<AActor>();
+			UTestAction* First = CreateAction<UTestReplaceAction>(Owner, true);
+			UTestAction* Second = CreateAction<UTestReplaceAction>(Owner);
+			TestNotNull("Created", Second);
+			TestTrue("First kept while the new one isn't active", First->IsRunning());
+
+			TestTrue("Activated", Second->Activate());
+			TestTrue("First cancelled", First->GetState() == EActionState::Cancelled);
+			UActionsSubsystem::Get(GetWorld())->CancelAllByOwner(Owner);
+			Owner->Destroy();
+		});
+
+		It("Refreshes the running action once the new one would activate", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			AActor* Owner = GetWorld()->SpawnActor<AActor>();
+			UTestRefreshAction* First = CreateAction<UTestRefreshAction>(Owner, true);
+			UTestRefreshAction* Second = CreateAction<UTestRefreshAction>(Owner);
+			TestNotNull("Created", Second);
+			TestEqual("Not refreshed on creation", First->NumRefreshes, 0);
+
+			TestFalse("Activated", Second->Activate());
+			TestEqual("Refreshed", First->NumRefreshes, 1);
+			UAction* Unique = Subsystem->GetUniqueAction(Owner, UTestRefreshAction::StaticClass());
+			TestTrue("Unique action", Unique == First);
+
+			// Auto activated actions are refreshed on creation, so none is returned
+			TestNull("Created with auto activation", CreateAction<UTestRefreshAction>(Owner, true));
+			TestEqual("Refreshed again", First->NumRefreshes, 2);
+			Subsystem->CancelAllByOwner(Owner);
+			Owner->Destroy();
+		});
+	});
+
+	Describe("Tick rate", [this]() {
+		It("Can change while ticking", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			TArray<UTestAction*> Actions;
+			for (int32 i = 0; i < 3; ++i)
+			{
+				UTestAction* Action = CreateAction<UTestAction>(GetWorld());
+				Action->SetWantsToTick(true);
+				Action->Activate();
+				Actions.Add(Action);
+			}
+
+			// Leaving the old group while groups tick must not touch the slots of the others
+			UTestAction* Action = Actions[0];
+			Action->TickRateOnTick = 1.f;
+			Subsystem->Tick(0.15f);
+			TestEqual("Ticked at the old rate", Action->NumTicks, 1);
+			TestEqual("Others ticked", Actions[2]->NumTicks, 1);
+
+			Actions[1]->Cancel();
+			Subsystem->Tick(0.5f);
+			TestEqual("Not due", Action->NumTicks, 1);
+			TestEqual("Others keep their rate", Actions[2]->NumTicks, 2);
+			Subsystem->Tick(0.5f);
+			TestEqual("Ticks at the new rate", Action->NumTicks, 2);
+
+			Action->TickRateOnTick = 0.f;
+			Actions[2]->Cancel();
+			Subsystem->Tick(1.f);
+			Subsystem->Tick(0.1f);
+			TestEqual("Ticks every frame", Action->NumTicks, 4);
+			Action->Cancel();
+		});
+	});
+
+	Describe("Fixed step", [this]() {
+		It("Drops steps beyond the catch-up limit", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			const int32 MaxSteps = GetDefault<UActionsSettings>()->MaxTickCatchUpSteps;
+			UTestAction* Action = CreateAction<UTestFixedStepAction>(GetWorld());
+			Action->SetWantsToTick(true);
+			Action->Activate();
+
+			// A long frame ticks up to the limit. The remainder of the last step is kept
+			Subsystem->Tick(0.1f * (MaxSteps + 10) + 0.05f);
+			TestEqual("Clamped", Action->NumTicks, MaxSteps);
+			Subsystem->Tick(0.06f);
+			TestEqual("Remainder kept", Action->NumTicks, MaxSteps + 1);
+			Action->Cancel();
+		});
+	});
+
+	Describe("Throttling", [this]() {
+		It("Stretches low priority ticks while over the target frame time", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			IConsoleVariable* Throttle = IConsoleManager::Get().FindConsoleVariable(TEXT("Actions.Throttle"));
+			IConsoleVariable* TargetFrameTime =
+				IConsoleManager::Get().FindConsoleVariable(TEXT("Actions.Throttle.TargetFrameTime"));
+			Throttle->Set(1, ECVF_SetByCode);
+			TargetFrameTime->Set(0.001f, ECVF_SetByCode);
+
+			UTestAction* Action = CreateAction<UTestLowPriorityAction>(GetWorld());
+			Action->SetWantsToTick(true);
+			Action->Activate();
+			const float TickRate = Action->GetTickRate();
+			const float MaxScale = GetDefault<UActionsSettings>()->GetMaxThrottleScale(EActionPriority::Low);
+
+			// Any frame is over a target of 1us, so the scale grows until it is capped
+			const float DeltaTime = 0.1f;
+			for (int32 i = 0; i < 10; ++i)
+			{
+				Subsystem->Tick(DeltaTime);
+			}
+			const float MaxInterval = FMath::Max(TickRate, DeltaTime) * MaxScale;
+			TestTrue("Throttling", Subsystem->GetThrottleScale() > 1.f);
+			TestTrue("Interval stretched", Subsystem->GetTickInterval(Action) > TickRate);
+			TestTrue("Interval capped", Subsystem->GetTickInterval(Action) <= MaxInterval + KINDA_SMALL_NUMBER);
+
+			Throttle->Set(0, ECVF_SetByCode);
+			Subsystem->Tick(DeltaTime);
+			TestEqual("Scale restored", Subsystem->GetThrottleScale(), 1.f);
+			TestEqual("Interval restored", Subsystem->GetTickInterval(Action), TickRate);
+
+			Throttle->Set(-1, ECVF_SetByCode);
+			TargetFrameTime->Set(0.f, ECVF_SetByCode);
+			Action->Cancel();
+		});
+	});
+
+	Describe("Deferred activation", [this]() {
+		It("Doesn't activate actions cancelled while pending", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			UTestAction* Action = CreateAction<UTestDeferredAction>(GetWorld());
+			UTestAction* Next = CreateAction<UTestDeferredAction>(GetWorld());
+			TestTrue("Queued", Action->Activate());
+			TestTrue("Next queued", Next->Activate());
+			TestTrue("Pending", Action->IsPending());
+
+			Action->Cancel();
+			TestFalse("Not pending", Action->IsPending());
+			TestTrue("Cancelled", Action->GetState() == EActionState::Cancelled);
+
+			Subsystem->Tick(0.1f);
+			TestFalse("Not activated", Action->IsRunning());
+			TestTrue("Next activated", Next->IsRunning());
+			Next->Cancel();
+		});
+	});
+
+	Describe("Suspension", [this]() {
+		It("Can suspend and resume Action", [this]() {
+			UTestAction* Action = CreateAction<UTestAction>(GetWorld(), true);
+			Action->Suspend();
+			TestTrue("Suspended", Action->IsSuspended());
+			TestTrue("Keeps running", Action->IsRunning());
+
+			Action->Resume();
+			TestFalse("Resumed", Action->IsSuspended());
+		});
+
+		It("Suspends actions activated on a suspended owner", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			UTestAction* First = CreateAction<UTestAction>(GetWorld(), true);
+			Subsystem->SuspendAllByOwner(GetWorld());
+			TestTrue("First suspended", First->IsSuspended());
+
+			UTestAction* Action = CreateAction<UTestAction>(GetWorld(), true);
+			TestTrue("Suspended", Action->IsSuspended());
+
+			Subsystem->ResumeAllByOwner(GetWorld());
+			TestFalse("Resumed", Action->IsSuspended());
+			First->Cancel();
+			Action->Cancel();
+		});
+
+		It("Ignores owners without actions", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			AActor* Owner = GetWorld()->SpawnActor<AActor>();
+			Subsystem->SuspendAllByOwner(Owner);
+			TestFalse("Not suspended", Subsystem->IsOwnerSuspended(Owner));
+			Owner->Destroy();
+		});
+	});
+
+	Describe("Release", [this]() {
+		It("Only finishes actions that ask for it", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			UTestAction* Released = CreateAction<UTestAction>(GetWorld(), true);
+			UTestAction* Finished = CreateAction<UTestFinishOnReleaseAction>(GetWorld(), true);
+			UTestAction* Child = CreateAction<UTestAction>(Finished, true);
+
+			Subsystem->ReleaseAll();
+			TestEqual("Released without callbacks", Released->NumFinishes, 0);
+			TestEqual("Finished", Finished->NumFinishes, 1);
+			TestEqual("Child finished with its parent", Child->NumFinishes, 1);
+			TestTrue("Cancelled", Finished->GetState() == EActionState::Cancelled);
+			TestFalse("Released", IsValid(Released));
+		});
+	});
+
+	Describe("Queries", [this]() {
+		It("Can find running actions by class", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			UTestAction* Action = CreateAction<UTestAction>(GetWorld(), true);
+
+			FActionQuery Query;
+			Query.Class = UTestAction::StaticClass();
+			TArray<UAction*> Actions;
+			Subsystem->FindActions(Query, Actions);
+			TestTrue("Found", Actions.Contains(Action));
+
+			Subsystem->CancelActions(Query);
+			TestEqual("Count after cancel", Subsystem->CountActions(Query), 0);
+		});
+	});
+
+	Describe("Channels", [this]() {
+		It("Queues actions while the channel is full", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			const FName Channel = TEXT("Test");
+			UAction* First = CreateActionInChannel(GetWorld(), UTestAction::StaticClass(), Channel);
+			UAction* Second = CreateActionInChannel(GetWorld(), UTestAction::StaticClass(), Channel);
+			TestNotNull("First started", First);
+			TestNull("Second queued", Second);
+			TestEqual("Queued", Subsystem->GetNumQueuedActions(GetWorld(), Channel), 1);
+
+			First->Succeed();
+			TestEqual("Started when slot freed", Subsystem->GetNumQueuedActions(GetWorld(), Channel), 0);
+			Subsystem->CancelAllByOwner(GetWorld());
+		});
+	});
+
+	Describe("Arena", [this]() {
+		It("Destroys all state on reset", [this]() {
+			struct FCounted
+			{
+				int32& Count;
+				FCounted(int32& Count) : Count(Count)
+				{
+					++Count;
+				}
+				~FCounted()
+				{
+					--Count;
+				}
+			};
+
+			int32 Count = 0;
+			FActionArena Arena;
+			for (int32 i = 0; i < 100; ++i)
+			{
+				Arena.New<FCounted>(Count);
+			}
+			TestEqual("Constructed", Count, 100);
+
+			Arena.Reset();
+			TestEqual("Destroyed", Count, 0);
+			TestEqual("Freed", Arena.GetAllocatedSize(), SIZE_T(0));
+		});
+	});
+
+	Describe("Class descriptors", [this]() {
+		It("Are built once per class", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			const FActionClassDescriptor& Descriptor = Subsystem->GetClassDescriptor(UTestAction::StaticClass());
+			TestTrue("Cached", &Descriptor == &Subsystem->GetClassDescriptor(UTestAction::StaticClass()));
+			TestTrue("Class chain", Descriptor.ClassChain.Contains(UAction::StaticClass()));
+		});
+	});
+
+	Describe("Garbage collection", [this]() {
+		It("Keeps running actions alive", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			FActionQuery Query;
+			Query.Class = UTestAction::StaticClass();
+			const int32 NumOtherActions = Subsystem->CountActions(Query);
+
+			constexpr int32 NumActions = 64;
+			for (int32 i = 0; i < NumActions; ++i)
+			{
+				CreateAction<UTestAction>(GetWorld(), true);
+			}
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			TestEqual("Alive", Subsystem->CountActions(Query), NumOtherActions + NumActions);
+			Subsystem->CancelAllByOwner(GetWorld());
+		});
+	});
+
+	Describe("Destroyed owners", [this]() {
+		It("Leave no actions behind after GC", [this]() {
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			FActionQuery Query;
+			Query.Class = UTestAction::StaticClass();
+			const int32 NumOtherActions = Subsystem->CountActions(Query);
+
+			AActor* Owner = GetWorld()->SpawnActor<AActor>();
+			for (int32 i = 0; i < 8; ++i)
+			{
+				UTestAction* Action = CreateAction<UTestAction>(Owner);
+				Action->SetWantsToTick(true);
+				Action->Activate();
+			}
+			TestEqual("Running", Subsystem->CountActions(Query), NumOtherActions + 8);
+
+			// Owner actions are swept on the next tick, and the tick after GC must not visit them
+			Owner->Destroy();
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			Subsystem->Tick(0.1f);
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			Subsystem->Tick(0.1f);
+			TestEqual("Torn down", Subsystem->CountActions(Query), NumOtherActions);
+		});
+	});
+
+	Describe("Batch creation", [this]() {
+		It("Creates an action for each owner", [this]() {
+			constexpr int32 NumOwners = 64;
+			UActionsSubsystem* Subsystem = UActionsSubsystem::Get(GetWorld());
+			TArray<UObject*> Owners;
+			for (int32 i = 0; i < NumOwners; ++i)
+			{
+				Owners.Add(GetWorld()->SpawnActor<AActor>());
+			}
+
+			const TArray<UAction*> Actions = CreateActions(Owners, UTestAction::StaticClass(), true);
+			TestEqual("Created", Actions.Num(), NumOwners);
+			TestFalse("All valid", Actions.Contains(nullptr));
+
+			for (UObject* Owner : Owners)
+			{
+				Subsystem->CancelAllByOwner(Owner);
+				CastChecked<AActor>(Owner)->Destroy();
+			}
+		});
 	});
 }
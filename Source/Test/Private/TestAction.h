@@ -12,4 +12,129 @@ UCLASS()
 class UTestAction : public UAction
 {
 	GENERATED_BODY()
+
+public:
+	int32 NumTicks = 0;
+	int32 NumFinishes = 0;
+	/** Tick rate this action sets on its next tick. Negative to keep it */
+	float TickRateOnTick = -1.f;
+
+protected:
+	void Tick(float DeltaTime) override
+	{
+		++NumTicks;
+		if (TickRateOnTick >= 0.f)
+		{
+			SetTickRate(TickRateOnTick);
+			TickRateOnTick = -1.f;
+		}
+	}
+
+	void OnFinish(const EActionState Reason) override
+	{
+		++NumFinishes;
+		Super::OnFinish(Reason);
+	}
+};
+
+
+UCLASS()
+class UTestLowPriorityAction : public UTestAction
+{
+	GENERATED_BODY()
+
+public:
+	UTestLowPriorityAction()
+	{
+		Priority = EActionPriority::Low;
+	}
+};
+
+
+UCLASS()
+class UTestFixedStepAction : public UTestAction
+{
+	GENERATED_BODY()
+
+public:
+	UTestFixedStepAction()
+	{
+		TickRate = 0.1f;
+		TickMode = EActionTickMode::FixedSubStep;
+	}
+};
+
+
+UCLASS()
+class UTestDeferredAction : public UTestAction
+{
+	GENERATED_BODY()
+
+public:
+	UTestDeferredAction()
+	{
+		bDeferredActivation = true;
+	}
+};
+
+
+UCLASS()
+class UTestFinishOnReleaseAction : public UTestAction
+{
+	GENERATED_BODY()
+
+public:
+	UTestFinishOnReleaseAction()
+	{
+		bFinishOnRelease = true;
+	}
+};
+
+
+UCLASS()
+class UTestReplaceAction : public UTestAction
+{
+	GENERATED_BODY()
+
+public:
+	UTestReplaceAction()
+	{
+		Uniqueness = EActionUniqueness::ReplaceOld;
+	}
+};
+
+
+UCLASS()
+class UTestRefreshAction : public UTestAction
+{
+	GENERATED_BODY()
+
+public:
+	int32 NumRefreshes = 0;
+
+	UTestRefreshAction()
+	{
+		Uniqueness = EActionUniqueness::RefreshExisting;
+	}
+
+protected:
+	void OnRefresh() override
+	{
+		++NumRefreshes;
+		Super::OnRefresh();
+	}
+};
+
+
+UCLASS()
+class UTestTaggedAction : public UTestAction
+{
+	GENERATED_BODY()
+
+public:
+	void SetTags(const FGameplayTagContainer& InTags, const FGameplayTagContainer& InCancelTags)
+	{
+		Tags = InTags;
+		CancelTags = InCancelTags;
+	}
 };